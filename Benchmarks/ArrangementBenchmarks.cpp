@@ -0,0 +1,219 @@
+// Arrangement benchmarks: construction (with and without the convex hull edges, EPECK and integer kernel, snap rounded),
+// save / load and two layer overlay.
+
+// Google Benchmark
+// https://github.com/google/benchmark/blob/main/docs/user_guide.md
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkData.h"
+#include "IntegerKernel.h"
+#include "ArrangementIO.h"
+#include "MemoryFootprint.h"
+#include "LayerOverlay.h"
+#include "SnapRounding.h"
+
+static void BM_BuildArrangment(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	size_t nrOfEdges = 0;
+	for (auto _ : state)
+	{
+		Arrangement_2D arr = BuildArrangmentWithHull(segments, Vector_Point_2D());
+		nrOfEdges = arr.number_of_edges();
+	}
+	state.counters["edges"] = (double)nrOfEdges;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildArrangment)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_BuildArrangmentWithHull(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	Vector_Point_2D convexHull = GrahamAndrew(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed + 1));
+	for (auto _ : state)
+	{
+		Arrangement_2D arr = BuildArrangmentWithHull(segments, convexHull);
+		benchmark::DoNotOptimize(arr.number_of_edges());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildArrangmentWithHull)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_BuildArrangmentIntegerInput(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateIntegerSegments((int)state.range(0));
+	for (auto _ : state)
+	{
+		Arrangement_2D arr = ConstructArrangment<Epeck_Coordinates>(segments);
+		benchmark::DoNotOptimize(arr.number_of_edges());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildArrangmentIntegerInput)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_BuildArrangmentIntegerKernel(benchmark::State& state)
+{
+	Vector_Integer_Segment_2D segments;
+	if (!ConvertToIntegerSegments<Integer_Coordinates<>>(GenerateIntegerSegments((int)state.range(0)), segments))
+	{
+		state.SkipWithError("Instance is not representable by the integer kernel");
+		return;
+	}
+	for (auto _ : state)
+	{
+		Integer_Coordinates<>::Arrangement arr = ConstructArrangment<Integer_Coordinates<>>(segments);
+		benchmark::DoNotOptimize(arr.number_of_edges());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildArrangmentIntegerKernel)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_SaveArrangment(benchmark::State& state)
+{
+	Arrangement_2D arr = BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed), Vector_Point_2D());
+	for (auto _ : state)
+	{
+		if (!WriteArrangmentSnapshot(TakeArrangmentSnapshot(arr), "benchmark_arrangment.txt"))
+		{
+			state.SkipWithError("Unable to write 'benchmark_arrangment.txt'");
+			break;
+		}
+	}
+	state.counters["faces"] = (double)arr.number_of_faces();
+}
+BENCHMARK(BM_SaveArrangment)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadArrangment(benchmark::State& state)
+{
+	Arrangement_2D arr = BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed), Vector_Point_2D());
+	if (!WriteArrangmentSnapshot(TakeArrangmentSnapshot(arr), "benchmark_arrangment.txt"))
+	{
+		state.SkipWithError("Unable to write 'benchmark_arrangment.txt'");
+		return;
+	}
+	for (auto _ : state)
+	{
+		Arrangement_2D loadedArr;
+		if (!LoadArrangment("benchmark_arrangment.txt", loadedArr))
+		{
+			state.SkipWithError("Unable to read 'benchmark_arrangment.txt'");
+			break;
+		}
+		benchmark::DoNotOptimize(loadedArr.number_of_edges());
+	}
+	state.counters["faces"] = (double)arr.number_of_faces();
+}
+BENCHMARK(BM_LoadArrangment)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Snap rounded construction on the unit grid, and the save / load round trip of its output, which fails unless the
+// loaded arrangment has as many vertices, edges and faces as the saved one.
+static void BM_BuildSnappedArrangment(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	Snap_Rounding_Report report;
+	size_t nrOfEdges = 0;
+	for (auto _ : state)
+	{
+		Arrangement_2D arr;
+		ConstructSnappedArrangment(segments, DefaultSnapRoundingOptions(), arr, &report);
+		nrOfEdges = arr.number_of_edges();
+	}
+	state.counters["edges"] = (double)nrOfEdges;
+	state.counters["offGrid"] = (double)report.offGridVertices;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildSnappedArrangment)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_LoadSnappedArrangment(benchmark::State& state)
+{
+	Arrangement_2D arr;
+	ConstructSnappedArrangment(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed), DefaultSnapRoundingOptions(), arr);
+	if (!WriteArrangmentSnapshot(TakeArrangmentSnapshot(arr), "benchmark_arrangment.txt"))
+	{
+		state.SkipWithError("Unable to write 'benchmark_arrangment.txt'");
+		return;
+	}
+	for (auto _ : state)
+	{
+		Arrangement_2D loadedArr;
+		if (!LoadArrangment("benchmark_arrangment.txt", loadedArr))
+		{
+			state.SkipWithError("Unable to read 'benchmark_arrangment.txt'");
+			break;
+		}
+		if (loadedArr.number_of_vertices() != arr.number_of_vertices() || loadedArr.number_of_edges() != arr.number_of_edges()
+			|| loadedArr.number_of_faces() != arr.number_of_faces())
+		{
+			state.SkipWithError("The loaded arrangment differs from the saved one");
+			break;
+		}
+	}
+	state.counters["vertices"] = (double)arr.number_of_vertices();
+}
+BENCHMARK(BM_LoadSnappedArrangment)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Memory footprint of the arrangement: DCEL record sizes, DCEL total and measured heap (the rest of the heap growth, lazy
+// exact numbers and allocator overhead, as other_heap_bytes).
+static void BM_ArrangmentFootprint(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	Arrangement_Footprint footprint;
+	for (auto _ : state)
+	{
+		Arrangement_2D arr;
+		footprint = MeasureArrangmentFootprint(segments, Vector_Point_2D(), arr);
+	}
+	state.counters["vertices"] = (double)footprint.vertices;
+	state.counters["halfedges"] = (double)footprint.halfedges;
+	state.counters["faces"] = (double)footprint.faces;
+	state.counters["bytes_per_vertex"] = (double)footprint.bytesPerVertex;
+	state.counters["bytes_per_halfedge"] = (double)footprint.bytesPerHalfedge;
+	state.counters["bytes_per_face"] = (double)footprint.bytesPerFace;
+	state.counters["dcel_bytes"] = (double)footprint.dcelBytes;
+	state.counters["heap_bytes"] = (double)footprint.heapBytes;
+	state.counters["other_heap_bytes"] = (double)footprint.otherHeapBytes;
+}
+BENCHMARK(BM_ArrangmentFootprint)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+// Overlay of two independent layers of seeded random segments (as zoning and road layers). Argument: number of segments
+// per layer.
+static void BM_OverlayLayers(benchmark::State& state)
+{
+	Arrangement_2D layerA = BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed), Vector_Point_2D());
+	Arrangement_2D layerB = BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed + 1), Vector_Point_2D());
+	size_t nrOfFaces = 0;
+	for (auto _ : state)
+	{
+		Overlay_Arrangement_2D overlay;
+		OverlayLayers(layerA, layerB, overlay);
+		nrOfFaces = overlay.number_of_faces();
+	}
+	state.counters["faces"] = (double)nrOfFaces;
+}
+BENCHMARK(BM_OverlayLayers)->RangeMultiplier(2)->Range(100, 400)->Unit(benchmark::kMillisecond);
+
+// Attribute merge after the sweep. Arguments: number of segments per layer, number of threads.
+static void BM_MergeFaceAttributes(benchmark::State& state)
+{
+	Arrangement_2D layerA = BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed), Vector_Point_2D());
+	Arrangement_2D layerB = BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed + 1), Vector_Point_2D());
+	Overlay_Arrangement_2D overlay;
+	OverlayLayers(layerA, layerB, overlay);
+	std::vector<int> zoning(layerA.number_of_faces());
+	std::vector<int> roads(layerB.number_of_faces());
+	for (size_t i = 0; i < zoning.size(); i++)
+	{
+		zoning[i] = (int)(i % 7);
+	}
+	for (size_t i = 0; i < roads.size(); i++)
+	{
+		roads[i] = (int)(i % 3);
+	}
+	for (auto _ : state)
+	{
+		std::vector<int> merged = MergeFaceAttributes(overlay, zoning, roads, [](int zone, int road) { return zone * 3 + road; }, (unsigned int)state.range(1));
+		benchmark::DoNotOptimize(merged.data());
+	}
+	state.SetItemsProcessed(state.iterations() * overlay.number_of_faces());
+}
+BENCHMARK(BM_MergeFaceAttributes)->ArgsProduct({ { 400 }, { 1, 2, 4 } })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,111 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Seeded benchmark instances, shared by the Google Benchmark targets and the performance regression runner.
+
+#ifndef BENCHMARK_DATA_H
+#define BENCHMARK_DATA_H
+
+// Common geometry types and the seeded instance generators
+#include "Geometry.h"
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// Every benchmark instance is generated from this seed, so all runs measure the same input.
+const unsigned int Benchmark_Seed = 20210601;
+
+// Instances are drawn from [Benchmark_Min_Bound, Benchmark_Max_Bound)^2.
+const int Benchmark_Min_Bound = 0;
+const int Benchmark_Max_Bound = 10000;
+
+// Convex hull containment benchmarks (the hull index and the arrangement baseline) locate the same queries in the hull
+// of this many seeded points.
+const int Hull_Benchmark_Points = 100000;
+
+/*
+* This function is responsible for generating the seeded containment queries against the benchmark hull: uniform over
+* the instance square widened by a tenth on each side, so some of them fall outside the hull.
+*/
+inline Vector_Point_2D GenerateHullQueries(int nrOfQueries)
+{
+	return GeneratePoints2DInstance(-Benchmark_Max_Bound / 10, Benchmark_Max_Bound + Benchmark_Max_Bound / 10, nrOfQueries, Benchmark_Seed + 1);
+}
+
+/*
+* This function is responsible for generating the seeded point instance of the given size, with coordinates rounded down
+* to integers (so the same instance can be fed to the integer kernel).
+*/
+inline Vector_Point_2D GenerateIntegerPoints(int nrOfElements, unsigned int seed = Benchmark_Seed)
+{
+	Vector_Point_2D points = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, nrOfElements, seed);
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		points[i] = Point_2D(std::floor(CGAL::to_double(points[i].x())), std::floor(CGAL::to_double(points[i].y())));
+	}
+	return points;
+}
+
+/*
+* This function is responsible for generating the seeded segment instance of the given size, with integer end points.
+* Degenerate segments (equal end points) are skipped.
+*/
+inline Vector_Line_Segment_2D GenerateIntegerSegments(int nrOfElements, unsigned int seed = Benchmark_Seed)
+{
+	Vector_Point_2D points = GenerateIntegerPoints(2 * nrOfElements, seed);
+	Vector_Line_Segment_2D segments;
+	for (size_t i = 0; i + 1 < points.size(); i += 2)
+	{
+		if (points[i] != points[i + 1])
+		{
+			segments.push_back(Line_Segment_2D(points[i], points[i + 1]));
+		}
+	}
+	return segments;
+}
+
+/*
+* This function is responsible for generating a seeded planar segment instance of the given size: the x - monotone
+* polyline through sorted random points, whose segments only meet at shared end points (a clean input for the
+* intersection tests).
+*/
+inline Vector_Line_Segment_2D GeneratePlanarSegments(int nrOfElements, unsigned int seed = Benchmark_Seed)
+{
+	Vector_Point_2D points = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, nrOfElements + 1, seed);
+	std::sort(points.begin(), points.end());
+	Vector_Line_Segment_2D segments;
+	for (size_t i = 0; i + 1 < points.size(); i++)
+	{
+		segments.push_back(Line_Segment_2D(points[i], points[i + 1]));
+	}
+	return segments;
+}
+
+/*
+* This function is responsible for generating a seeded instance of short segments: integer end points, the first one
+* uniform and the second one within maxLength of it along each axis. The number of intersections grows linearly with the
+* number of segments (about one per segment for a million segments of length up to 20), which is the regime where
+* the cost of the sweep structures, not the output, dominates.
+*/
+inline Vector_Line_Segment_2D GenerateShortSegments(int nrOfElements, int maxLength, unsigned int seed = Benchmark_Seed)
+{
+	Vector_Point_2D points = GenerateIntegerPoints(2 * nrOfElements, seed);
+	double halfRange = (Benchmark_Max_Bound - Benchmark_Min_Bound) / 2.0;
+	Vector_Line_Segment_2D segments;
+	for (size_t i = 0; i + 1 < points.size(); i += 2)
+	{
+		double dx = std::floor((CGAL::to_double(points[i + 1].x()) - Benchmark_Min_Bound - halfRange) * maxLength / halfRange);
+		double dy = std::floor((CGAL::to_double(points[i + 1].y()) - Benchmark_Min_Bound - halfRange) * maxLength / halfRange);
+		if (dx != 0 || dy != 0)
+		{
+			segments.push_back(Line_Segment_2D(points[i], Point_2D(CGAL::to_double(points[i].x()) + dx, CGAL::to_double(points[i].y()) + dy)));
+		}
+	}
+	return segments;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+// Convex hull benchmarks: Graham - Andrew on the EPECK and the integer kernel, convex hull containment queries, the
+// dynamic convex hull and batched hulls of small groups.
+
+// Google Benchmark
+// https://github.com/google/benchmark/blob/main/docs/user_guide.md
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkData.h"
+#include "IntegerKernel.h"
+#include "HullContainment.h"
+#include "DynamicConvexHull.h"
+
+static void BM_GrahamAndrew(benchmark::State& state)
+{
+	Vector_Point_2D points = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	for (auto _ : state)
+	{
+		Vector_Point_2D convexHull = GrahamAndrew(points);
+		benchmark::DoNotOptimize(convexHull.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GrahamAndrew)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+// Same integer instance on both kernels.
+static void BM_GrahamAndrewIntegerInput(benchmark::State& state)
+{
+	Vector_Point_2D points = GenerateIntegerPoints((int)state.range(0));
+	for (auto _ : state)
+	{
+		Vector_Point_2D convexHull = GrahamAndrew(points);
+		benchmark::DoNotOptimize(convexHull.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GrahamAndrewIntegerInput)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_GrahamAndrewIntegerKernel(benchmark::State& state)
+{
+	Vector_Integer_Point_2D points;
+	if (!ConvertToIntegerPoints<Integer_Coordinates<>>(GenerateIntegerPoints((int)state.range(0)), points))
+	{
+		state.SkipWithError("Instance is not representable by the integer kernel");
+		return;
+	}
+	for (auto _ : state)
+	{
+		Vector_Integer_Point_2D convexHull = GrahamAndrew<Integer_Coordinates<>>(points);
+		benchmark::DoNotOptimize(convexHull.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GrahamAndrewIntegerKernel)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_ConvexHullIndexBuild(benchmark::State& state)
+{
+	Vector_Point_2D convexHull = GrahamAndrew(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed));
+	for (auto _ : state)
+	{
+		Convex_Hull_Index index(convexHull);
+		benchmark::DoNotOptimize(index.Size());
+	}
+}
+BENCHMARK(BM_ConvexHullIndexBuild)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Arguments: number of queries, number of threads. With one thread this is the head - to - head of BM_LocateHullTrapezoid
+// (PointLocationBenchmarks.cpp), which answers the same queries on the same hull through an arrangement; the inside
+// counters of the two must agree.
+static void BM_ConvexHullIndexBatchLocate(benchmark::State& state)
+{
+	Convex_Hull_Index index(GrahamAndrew(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Hull_Benchmark_Points, Benchmark_Seed)));
+	Vector_Point_2D queries = GenerateHullQueries((int)state.range(0));
+	std::vector<double> coordinates;
+	for (int i = 0; i < queries.size(); i++)
+	{
+		coordinates.push_back(CGAL::to_double(queries[i].x()));
+		coordinates.push_back(CGAL::to_double(queries[i].y()));
+	}
+	size_t inside = 0;
+	for (auto _ : state)
+	{
+		Vector_Bounded_Side result = index.BatchLocate(coordinates, (unsigned int)state.range(1));
+		benchmark::DoNotOptimize(result.data());
+		inside = result.size() - std::count(result.begin(), result.end(), CGAL::ON_UNBOUNDED_SIDE);
+	}
+	state.counters["hull_vertices"] = (double)index.Size();
+	state.counters["inside"] = (double)inside;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConvexHullIndexBatchLocate)->Args({ 100000, 1 })->Args({ 1000000, 1 })->Args({ 1000000, 0 })->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Moving fleet of n positions: every iteration retires one position and inserts a new one (the retired positions are
+// reused later), then the hull is current. The recomputing variant runs Graham - Andrew on the whole fleet instead.
+static void BM_DynamicHullUpdate(benchmark::State& state)
+{
+	int n = (int)state.range(0);
+	Vector_Point_2D fleet = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, n, Benchmark_Seed);
+	Vector_Point_2D fresh = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, n, Benchmark_Seed + 1);
+	Dynamic_Convex_Hull dynamicHull;
+	for (int i = 0; i < n; i++)
+	{
+		dynamicHull.Insert(fleet[i]);
+	}
+	size_t slot = 0;
+	for (auto _ : state)
+	{
+		dynamicHull.Remove(fleet[slot]);
+		std::swap(fleet[slot], fresh[slot]);
+		dynamicHull.Insert(fleet[slot]);
+		slot = (slot + 1) % n;
+	}
+	state.counters["height"] = dynamicHull.Height();
+	state.counters["hull_points"] = (double)dynamicHull.Hull().size();
+}
+BENCHMARK(BM_DynamicHullUpdate)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BM_RecomputeHullUpdate(benchmark::State& state)
+{
+	int n = (int)state.range(0);
+	Vector_Point_2D fleet = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, n, Benchmark_Seed);
+	Vector_Point_2D fresh = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, n, Benchmark_Seed + 1);
+	size_t slot = 0;
+	for (auto _ : state)
+	{
+		std::swap(fleet[slot], fresh[slot]);
+		slot = (slot + 1) % n;
+		Vector_Point_2D convexHull = GrahamAndrew(fleet);
+		benchmark::DoNotOptimize(convexHull.data());
+	}
+}
+BENCHMARK(BM_RecomputeHullUpdate)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Hulls of many small groups (as one per vehicle). Arguments: number of groups of 16 points, number of threads (batch only).
+static void BM_GrahamAndrewPerGroup(benchmark::State& state)
+{
+	Vector_Point_2D points = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 16 * (int)state.range(0), Benchmark_Seed);
+	for (auto _ : state)
+	{
+		for (size_t offset = 0; offset < points.size(); offset += 16)
+		{
+			Vector_Point_2D convexHull = GrahamAndrew(Vector_Point_2D(points.begin() + offset, points.begin() + offset + 16));
+			benchmark::DoNotOptimize(convexHull.data());
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GrahamAndrewPerGroup)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+static void BM_BatchGrahamAndrew(benchmark::State& state)
+{
+	Vector_Point_2D points = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 16 * (int)state.range(0), Benchmark_Seed);
+	std::vector<size_t> offsets;
+	for (size_t offset = 0; offset <= points.size(); offset += 16)
+	{
+		offsets.push_back(offset);
+	}
+	Vector_Point_2D hulls;
+	std::vector<size_t> hullOffsets;
+	for (auto _ : state)
+	{
+		BatchGrahamAndrew(points, offsets, hulls, hullOffsets, (unsigned int)state.range(1));
+		benchmark::DoNotOptimize(hulls.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchGrahamAndrew)->ArgsProduct({ { 1000, 10000, 100000 }, { 1, 4 } })->Unit(benchmark::kMillisecond);
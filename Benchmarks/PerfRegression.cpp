@@ -0,0 +1,394 @@
+// Linker to Header File
+#include "PerfRegression.h"
+
+// Algorithms under measurement
+#include "PlaneSweep.h"
+#include "IntegerKernel.h"
+#include "HullContainment.h"
+#include "ArrangementIO.h"
+#include "PersistentSlabPointLocation.h"
+#include "TrapezoidIndex.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that defines smart pointers (std::shared_ptr) for dynamic memory management.
+// * https://www.cplusplus.com/reference/memory/
+#include <memory>
+
+// Boost Property Tree JSON parser (Boost is already required by CGAL), used to read the baselines.
+// https://www.boost.org/doc/libs/1_74_0/doc/html/property_tree/parsers.html#property_tree.parsers.json_parser
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+namespace
+{
+	typedef std::chrono::steady_clock Clock;
+
+	// Sizes of the workload matrix.
+	const int Hull_Points = 100000;
+	const int Containment_Queries = 1000000;
+	const int Sweep_Segments = 400;
+	const int Planar_Segments = 20000;
+	const int Arrangement_Segments = 400;
+	const int Locate_Segments = 200;
+	const int Locate_Queries = 10000;
+
+	const String Arrangement_File = "perf_regression_arrangment.txt";
+
+#ifdef __VERSION__
+	const String Compiler_Version = __VERSION__;
+#else
+	const String Compiler_Version = "unknown";
+#endif
+
+	double ElapsedSeconds(Clock::time_point begin, Clock::time_point end)
+	{
+		return std::chrono::duration<double>(end - begin).count();
+	}
+
+	// A repetition consisting of a single timed call of operation, which processes the given number of items.
+	template <class Operation>
+	Perf_Repetition SingleOperation(Operation operation, size_t items)
+	{
+		return [operation, items](Latency_Samples& samples) mutable
+		{
+			Clock::time_point begin = Clock::now();
+			operation();
+			samples.push_back(ElapsedSeconds(begin, Clock::now()));
+			return items;
+		};
+	}
+
+	Vector_Line_Segment_2D RandomSegments(int nrOfSegments)
+	{
+		return GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, nrOfSegments, Benchmark_Seed);
+	}
+
+	template <class Strategy>
+	std::unique_ptr<Strategy> MakeStrategy(const Arrangement_2D& arr)
+	{
+		return std::unique_ptr<Strategy>(new Strategy(arr));
+	}
+
+	// The trapezoidal map is built from the benchmark seed, so every run measures the same search structure.
+	template <>
+	std::unique_ptr<Trapezoid_Point_Location> MakeStrategy<Trapezoid_Point_Location>(const Arrangement_2D& arr)
+	{
+		std::unique_ptr<Trapezoid_Point_Location> pl(new Trapezoid_Point_Location());
+		AttachTrapezoidPointLocation(*pl, arr, true, Benchmark_Seed);
+		return pl;
+	}
+
+	// The point location object is declared after (and so destroyed before) the arrangement it is attached to.
+	template <class Strategy>
+	struct Located_Arrangement
+	{
+		Arrangement_2D arr;
+		std::unique_ptr<Strategy> pl;
+		Vector_Point_2D queries;
+
+		Located_Arrangement()
+			: arr(BuildArrangmentWithHull(RandomSegments(Locate_Segments), Vector_Point_2D())),
+			pl(MakeStrategy<Strategy>(arr)),
+			queries(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Locate_Queries, Benchmark_Seed + 1))
+		{
+		}
+	};
+
+	// The strategies of this project must locate the seeded queries as CGAL does before they are measured.
+	template <class Strategy>
+	bool CheckStrategy(const Located_Arrangement<Strategy>&)
+	{
+		return true;
+	}
+
+	template <>
+	bool CheckStrategy<Persistent_Slab_Point_Location>(const Located_Arrangement<Persistent_Slab_Point_Location>& located)
+	{
+		return CrossCheckPersistentSlabPointLocation(located.arr, located.queries, 0, Benchmark_Seed);
+	}
+
+	// Every query of a repetition is timed on its own.
+	template <class Strategy>
+	Perf_Workload LocateWorkload(String name)
+	{
+		Perf_Workload workload;
+		workload.name = name + "/" + std::to_string(Locate_Segments);
+		workload.prepare = []()
+		{
+			std::shared_ptr<Located_Arrangement<Strategy>> located = std::make_shared<Located_Arrangement<Strategy>>();
+			if (!CheckStrategy(*located))
+			{
+				return Perf_Repetition();
+			}
+			return Perf_Repetition([located](Latency_Samples& samples)
+			{
+				for (int i = 0; i < located->queries.size(); i++)
+				{
+					Clock::time_point begin = Clock::now();
+					Location_Result_Type result = located->pl->locate(located->queries[i]);
+					samples.push_back(ElapsedSeconds(begin, Clock::now()));
+				}
+				return located->queries.size();
+			});
+		};
+		return workload;
+	}
+
+	// Nearest - rank percentile of sorted samples.
+	double Percentile(const Latency_Samples& sorted, double p)
+	{
+		if (sorted.empty())
+		{
+			return 0;
+		}
+		size_t rank = (size_t)std::ceil(p * sorted.size());
+		return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+	}
+
+	double RelativeChange(double baseline, double current)
+	{
+		return baseline == 0 ? 0 : (current - baseline) / baseline;
+	}
+}
+
+std::vector<Perf_Workload> DefaultPerfWorkloads()
+{
+	std::vector<Perf_Workload> workloads;
+	Perf_Workload workload;
+
+	workload.name = "hull/graham_andrew/" + std::to_string(Hull_Points);
+	workload.prepare = []()
+	{
+		Vector_Point_2D points = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Hull_Points, Benchmark_Seed);
+		return SingleOperation([points]() { GrahamAndrew(points); }, points.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "hull/graham_andrew_integer_kernel/" + std::to_string(Hull_Points);
+	workload.prepare = []()
+	{
+		Vector_Integer_Point_2D points;
+		if (!ConvertToIntegerPoints<Integer_Coordinates<>>(GenerateIntegerPoints(Hull_Points), points))
+		{
+			return Perf_Repetition();
+		}
+		return SingleOperation([points]() { GrahamAndrew<Integer_Coordinates<>>(points); }, points.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "hull/containment_batch/" + std::to_string(Containment_Queries);
+	workload.prepare = []()
+	{
+		std::shared_ptr<Convex_Hull_Index> index = std::make_shared<Convex_Hull_Index>(
+			GrahamAndrew(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Hull_Points, Benchmark_Seed)));
+		Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Containment_Queries, Benchmark_Seed + 1);
+		std::vector<double> coordinates;
+		coordinates.reserve(2 * queries.size());
+		for (int i = 0; i < queries.size(); i++)
+		{
+			coordinates.push_back(CGAL::to_double(queries[i].x()));
+			coordinates.push_back(CGAL::to_double(queries[i].y()));
+		}
+		// A single thread, so the result does not depend on the number of cores of the machine.
+		return SingleOperation([index, coordinates]() { index->BatchLocate(coordinates, 1); }, queries.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "sweep/compute_intersection_points/" + std::to_string(Sweep_Segments);
+	workload.prepare = []()
+	{
+		Vector_Line_Segment_2D segments = RandomSegments(Sweep_Segments);
+		return SingleOperation([segments]() { findSegmentLineIntersection(segments); }, segments.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "sweep/count_intersections/" + std::to_string(Sweep_Segments);
+	workload.prepare = []()
+	{
+		Vector_Line_Segment_2D segments = RandomSegments(Sweep_Segments);
+		return SingleOperation([segments]() { countSegmentLineIntersections(segments); }, segments.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "sweep/any_intersection_planar/" + std::to_string(Planar_Segments);
+	workload.prepare = []()
+	{
+		Vector_Line_Segment_2D segments = GeneratePlanarSegments(Planar_Segments);
+		return SingleOperation([segments]() { anySegmentLineIntersection(segments); }, segments.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "arrangement/build/" + std::to_string(Arrangement_Segments);
+	workload.prepare = []()
+	{
+		Vector_Line_Segment_2D segments = RandomSegments(Arrangement_Segments);
+		return SingleOperation([segments]() { BuildArrangmentWithHull(segments, Vector_Point_2D()); }, segments.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "arrangement/build_with_hull/" + std::to_string(Arrangement_Segments);
+	workload.prepare = []()
+	{
+		Vector_Line_Segment_2D segments = RandomSegments(Arrangement_Segments);
+		Vector_Point_2D convexHull = GrahamAndrew(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Arrangement_Segments, Benchmark_Seed + 1));
+		return SingleOperation([segments, convexHull]() { BuildArrangmentWithHull(segments, convexHull); }, segments.size());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "arrangement/save/" + std::to_string(Arrangement_Segments);
+	workload.prepare = []()
+	{
+		std::shared_ptr<Arrangement_2D> arr = std::make_shared<Arrangement_2D>(BuildArrangmentWithHull(RandomSegments(Arrangement_Segments), Vector_Point_2D()));
+		return SingleOperation([arr]() { WriteArrangmentSnapshot(TakeArrangmentSnapshot(*arr), Arrangement_File); }, arr->number_of_faces());
+	};
+	workloads.push_back(workload);
+
+	workload.name = "arrangement/load/" + std::to_string(Arrangement_Segments);
+	workload.prepare = []()
+	{
+		Arrangement_2D arr = BuildArrangmentWithHull(RandomSegments(Arrangement_Segments), Vector_Point_2D());
+		WriteArrangmentSnapshot(TakeArrangmentSnapshot(arr), Arrangement_File);
+		return SingleOperation([]() { Arrangement_2D loadedArr; LoadArrangment(Arrangement_File, loadedArr); }, arr.number_of_faces());
+	};
+	workloads.push_back(workload);
+
+	workloads.push_back(LocateWorkload<Naive_Point_Location>("locate/naive"));
+	workloads.push_back(LocateWorkload<Walk_Along_Line_Point_Location>("locate/walk_along_line"));
+	workloads.push_back(LocateWorkload<LandMarks_Point_Location>("locate/landmarks"));
+	workloads.push_back(LocateWorkload<Trapezoid_Point_Location>("locate/trapezoid"));
+	workloads.push_back(LocateWorkload<Persistent_Slab_Point_Location>("locate/persistent_slab"));
+	return workloads;
+}
+
+Perf_Environment CurrentPerfEnvironment()
+{
+	Perf_Environment environment;
+	environment.compiler = Compiler_Version;
+	environment.hardwareThreads = std::thread::hardware_concurrency();
+	return environment;
+}
+
+bool SamePerfEnvironment(const Perf_Environment& a, const Perf_Environment& b)
+{
+	return a.compiler == b.compiler && a.hardwareThreads == b.hardwareThreads;
+}
+
+bool RunPerfWorkload(const Perf_Workload& workload, int repetitions, Perf_Result& result)
+{
+	Perf_Repetition repetition = workload.prepare();
+	if (!repetition)
+	{
+		return false;
+	}
+
+	// Warm - up: caches, allocator and the lazily computed exact values of the input.
+	Latency_Samples warmUp;
+	repetition(warmUp);
+
+	Latency_Samples samples;
+	std::vector<double> throughputs;
+	for (int r = 0; r < repetitions; r++)
+	{
+		Clock::time_point begin = Clock::now();
+		size_t items = repetition(samples);
+		double seconds = ElapsedSeconds(begin, Clock::now());
+		throughputs.push_back(seconds > 0 ? items / seconds : 0);
+	}
+	std::sort(throughputs.begin(), throughputs.end());
+	std::sort(samples.begin(), samples.end());
+
+	result.name = workload.name;
+	result.throughput = throughputs.empty() ? 0 : throughputs[throughputs.size() / 2];
+	result.p50Latency = Percentile(samples, 0.50);
+	result.p99Latency = Percentile(samples, 0.99);
+	result.operations = samples.size();
+	return true;
+}
+
+bool WritePerfBaseline(const std::vector<Perf_Result>& results, String path)
+{
+	std::ofstream myfile(path);
+	if (!myfile.is_open())
+	{
+		return false;
+	}
+	myfile << std::scientific << std::setprecision(6);
+	myfile << "{\n";
+	Perf_Environment environment = CurrentPerfEnvironment();
+	myfile << "  \"hardware_threads\": " << environment.hardwareThreads << ",\n";
+	myfile << "  \"compiler\": \"" << environment.compiler << "\",\n";
+	myfile << "  \"workloads\": [\n";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		myfile << "    { \"name\": \"" << results[i].name << "\""
+			<< ", \"throughput\": " << results[i].throughput
+			<< ", \"p50_latency\": " << results[i].p50Latency
+			<< ", \"p99_latency\": " << results[i].p99Latency
+			<< ", \"operations\": " << results[i].operations << " }"
+			<< (i + 1 < results.size() ? "," : "") << "\n";
+	}
+	myfile << "  ]\n";
+	myfile << "}\n";
+	myfile.close();
+	return !myfile.fail();
+}
+
+bool ReadPerfBaseline(String path, Perf_Environment& environment, std::vector<Perf_Result>& results)
+{
+	results.clear();
+	boost::property_tree::ptree tree;
+	try
+	{
+		boost::property_tree::read_json(path, tree);
+		environment.compiler = tree.get<String>("compiler");
+		environment.hardwareThreads = tree.get<unsigned int>("hardware_threads");
+		for (const boost::property_tree::ptree::value_type& entry : tree.get_child("workloads"))
+		{
+			Perf_Result result;
+			result.name = entry.second.get<String>("name");
+			result.throughput = entry.second.get<double>("throughput");
+			result.p50Latency = entry.second.get<double>("p50_latency");
+			result.p99Latency = entry.second.get<double>("p99_latency");
+			result.operations = entry.second.get<size_t>("operations");
+			results.push_back(result);
+		}
+	}
+	catch (const boost::property_tree::ptree_error&)
+	{
+		results.clear();
+		return false;
+	}
+	return true;
+}
+
+int ComparePerfResults(const std::vector<Perf_Result>& baseline, const std::vector<Perf_Result>& current, Perf_Thresholds thresholds, std::ostream& out)
+{
+	int regressions = 0;
+	out << std::fixed << std::setprecision(1);
+	for (size_t i = 0; i < current.size(); i++)
+	{
+		const Perf_Result& result = current[i];
+		std::vector<Perf_Result>::const_iterator reference = std::find_if(baseline.begin(), baseline.end(),
+			[&result](const Perf_Result& entry) { return entry.name == result.name; });
+		out << std::left << std::setw(48) << result.name << std::right;
+		if (reference == baseline.end())
+		{
+			out << "  new (no baseline)" << std::endl;
+			continue;
+		}
+		double throughputChange = RelativeChange(reference->throughput, result.throughput);
+		double latencyChange = RelativeChange(reference->p99Latency, result.p99Latency);
+		bool regressed = throughputChange < -thresholds.throughput || latencyChange > thresholds.p99Latency;
+		out << "  throughput " << std::setw(7) << 100 * throughputChange << "%"
+			<< "  p99 " << std::setw(7) << 100 * latencyChange << "%"
+			<< "  " << (regressed ? "REGRESSION" : "ok") << std::endl;
+		if (regressed)
+		{
+			regressions++;
+		}
+	}
+	return regressions;
+}
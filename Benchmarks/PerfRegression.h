@@ -0,0 +1,110 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Performance regression suite: a fixed, seeded workload matrix over the functions of the project, whose results are
+// stored as JSON baselines and compared against later runs.
+
+#ifndef PERF_REGRESSION_H
+#define PERF_REGRESSION_H
+
+// Seeded benchmark instances
+#include "BenchmarkData.h"
+
+// * Class template std::function is a general-purpose polymorphic function wrapper.
+// * https://www.cplusplus.com/reference/functional/function/
+#include <functional>
+
+// Latencies, in seconds, of the individual operations of a repetition.
+typedef std::vector<double> Latency_Samples;
+
+// Runs one (timed) repetition of a workload: appends the latency of every operation to the samples and returns the
+// number of items processed.
+typedef std::function<size_t(Latency_Samples&)> Perf_Repetition;
+
+/*
+* A workload of the matrix. prepare generates the seeded input and builds whatever the measured operation needs
+* (not timed) and returns the function that runs one repetition, or an empty function if the input cannot be prepared.
+*/
+struct Perf_Workload
+{
+	String name;
+	std::function<Perf_Repetition()> prepare;
+};
+
+/*
+* The measurements of a workload: throughput is the median, over the repetitions, of items processed per second;
+* the latency percentiles are taken over the operations of all the repetitions.
+*/
+struct Perf_Result
+{
+	String name;
+	double throughput;
+	double p50Latency;
+	double p99Latency;
+	size_t operations;
+};
+
+/*
+* The machine and compiler a baseline was recorded with. Baselines are only compared on the same compiler version and
+* hardware thread count.
+*/
+struct Perf_Environment
+{
+	String compiler;
+	unsigned int hardwareThreads;
+};
+
+/*
+* Allowed relative regressions: a workload regresses when its throughput drops by more than throughput
+* (e.g. 0.1 = 10%) or its p99 latency grows by more than p99Latency.
+*/
+struct Perf_Thresholds
+{
+	double throughput;
+	double p99Latency;
+};
+
+/*
+* This function is responsible for returning the workload matrix: convex hull (EPECK and integer kernel), hull
+* containment, sweep intersection (points, intersecting pairs and planarity check), arrangement construction,
+* save / load, and the four point location strategies.
+* Every input is generated from Benchmark_Seed, so every run measures the same instances.
+*/
+std::vector<Perf_Workload> DefaultPerfWorkloads();
+
+/*
+* This function is responsible for returning the environment of the running executable: the compiler it was built with
+* and the number of hardware threads of the machine.
+*/
+Perf_Environment CurrentPerfEnvironment();
+
+/*
+* This function is responsible for deciding whether results recorded in the two environments are comparable.
+*/
+bool SamePerfEnvironment(const Perf_Environment& a, const Perf_Environment& b);
+
+/*
+* This function is responsible for running a workload: one untimed warm - up repetition followed by the given number
+* of measured repetitions. Returns false if the workload cannot prepare its input.
+*/
+bool RunPerfWorkload(const Perf_Workload& workload, int repetitions, Perf_Result& result);
+
+/*
+* This function is responsible for writting the given results, with the current environment, as a JSON baseline to the
+* file provided by the given path.
+*/
+bool WritePerfBaseline(const std::vector<Perf_Result>& results, String path);
+
+/*
+* This function is responsible for reading a JSON baseline written by WritePerfBaseline, and the environment it was
+* recorded in. Returns false if the file does not exist or cannot be parsed.
+*/
+bool ReadPerfBaseline(String path, Perf_Environment& environment, std::vector<Perf_Result>& results);
+
+/*
+* This function is responsible for comparing the current results against the baseline, displaying one line per
+* workload to the given stream, and returning the number of workloads that regressed beyond the thresholds.
+* Workloads missing from the baseline are reported but never count as regressions.
+*/
+int ComparePerfResults(const std::vector<Perf_Result>& baseline, const std::vector<Perf_Result>& current, Perf_Thresholds thresholds, std::ostream& out);
+#endif
@@ -0,0 +1,143 @@
+// Linker to Header File
+#include "PerfRegression.h"
+
+// * Header that defines std::strtod and std::atoi.
+// * https://www.cplusplus.com/reference/cstdlib/
+#include <cstdlib>
+
+// * Header that defines std::ifstream.
+// * https://www.cplusplus.com/reference/fstream/
+#include <fstream>
+
+/*
+* Usage: perf_regression [--baseline <path>] [--update] [--require-baseline] [--threshold <t>] [--latency-threshold <t>]
+*                        [--repetitions <n>] [--filter <substring>]
+* Runs the workload matrix and compares it against the baseline (default: perf_baseline.json). With --update the
+* results are written as the new baseline instead. A baseline that does not exist, or was recorded with another compiler
+* or hardware thread count, cannot be compared with: the comparison is skipped and reported, with exit status 0 (2 with
+* --require-baseline). Exit status: 0 when no workload regressed or the comparison was skipped, 1 when at least one
+* workload regressed, 2 when the baseline cannot be read (or is missing or foreign, with --require-baseline), 3 on
+* invalid arguments, I/O errors or a workload that cannot prepare its input.
+*/
+int main(int argc, char* argv[])
+{
+	String baselinePath = "perf_baseline.json";
+	bool update = false;
+	bool requireBaseline = false;
+	Perf_Thresholds thresholds;
+	thresholds.throughput = 0.10;
+	thresholds.p99Latency = 0.25;
+	int repetitions = 7;
+	String filter = "";
+
+	for (int i = 1; i < argc; i++)
+	{
+		String argument = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (argument == "--update")
+		{
+			update = true;
+		}
+		else if (argument == "--require-baseline")
+		{
+			requireBaseline = true;
+		}
+		else if (argument == "--baseline" && hasValue)
+		{
+			baselinePath = argv[++i];
+		}
+		else if (argument == "--threshold" && hasValue)
+		{
+			thresholds.throughput = std::strtod(argv[++i], nullptr);
+		}
+		else if (argument == "--latency-threshold" && hasValue)
+		{
+			thresholds.p99Latency = std::strtod(argv[++i], nullptr);
+		}
+		else if (argument == "--repetitions" && hasValue)
+		{
+			repetitions = std::max(1, std::atoi(argv[++i]));
+		}
+		else if (argument == "--filter" && hasValue)
+		{
+			filter = argv[++i];
+		}
+		else
+		{
+			std::cout << "Unknown argument: " << argument << std::endl;
+			return 3;
+		}
+	}
+
+	Perf_Environment environment = CurrentPerfEnvironment();
+	Perf_Environment baselineEnvironment;
+	std::vector<Perf_Result> baseline;
+	if (!update && !std::ifstream(baselinePath).is_open())
+	{
+		std::cout << "No baseline '" << baselinePath << "'; skipping the comparison (record one with --update)." << std::endl;
+		return requireBaseline ? 2 : 0;
+	}
+	if (!update && !ReadPerfBaseline(baselinePath, baselineEnvironment, baseline))
+	{
+		std::cout << "Unable to read the baseline '" << baselinePath << "'; record one with --update." << std::endl;
+		return 2;
+	}
+	if (!update && !SamePerfEnvironment(environment, baselineEnvironment))
+	{
+		std::cout << "The baseline '" << baselinePath << "' was recorded with compiler '" << baselineEnvironment.compiler
+			<< "' on " << baselineEnvironment.hardwareThreads << " hardware threads; this run uses '" << environment.compiler
+			<< "' on " << environment.hardwareThreads << ". Skipping the comparison (record a baseline for this machine with"
+			<< " --update)." << std::endl;
+		return requireBaseline ? 2 : 0;
+	}
+
+	std::vector<Perf_Workload> workloads = DefaultPerfWorkloads();
+	std::vector<Perf_Result> results;
+	for (size_t i = 0; i < workloads.size(); i++)
+	{
+		if (workloads[i].name.find(filter) == String::npos)
+		{
+			continue;
+		}
+		Perf_Result result;
+		if (!RunPerfWorkload(workloads[i], repetitions, result))
+		{
+			std::cout << "Unable to prepare the input of '" << workloads[i].name << "'." << std::endl;
+			return 3;
+		}
+		std::cout << std::left << std::setw(48) << result.name << std::right << std::scientific << std::setprecision(3)
+			<< "  " << result.throughput << " items/s"
+			<< "  p50 " << result.p50Latency << " s"
+			<< "  p99 " << result.p99Latency << " s" << std::endl;
+		results.push_back(result);
+	}
+	std::cout << "--------------------------------------------------" << std::endl;
+
+	if (update)
+	{
+		// Keep the baseline entries of the workloads that were filtered out, if they were recorded in this environment.
+		std::vector<Perf_Result> previous;
+		if (ReadPerfBaseline(baselinePath, baselineEnvironment, previous) && SamePerfEnvironment(environment, baselineEnvironment))
+		{
+			for (size_t i = 0; i < previous.size(); i++)
+			{
+				if (previous[i].name.find(filter) == String::npos)
+				{
+					results.push_back(previous[i]);
+				}
+			}
+		}
+		if (!WritePerfBaseline(results, baselinePath))
+		{
+			std::cout << "Unable to write the baseline '" << baselinePath << "'." << std::endl;
+			return 3;
+		}
+		std::cout << "Baseline written to '" << baselinePath << "'." << std::endl;
+		return 0;
+	}
+
+	int regressions = ComparePerfResults(baseline, results, thresholds, std::cout);
+	std::cout << "--------------------------------------------------" << std::endl;
+	std::cout << regressions << " regression(s)" << std::endl;
+	return regressions == 0 ? 0 : 1;
+}
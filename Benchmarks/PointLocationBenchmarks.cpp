@@ -0,0 +1,421 @@
+// Point location benchmarks: index construction and queries for the four CGAL strategies.
+
+// Google Benchmark
+// https://github.com/google/benchmark/blob/main/docs/user_guide.md
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkData.h"
+#include "PointLocation.h"
+#include "MemoryFootprint.h"
+#include "LandmarkTuning.h"
+#include "TrapezoidIndex.h"
+#include "TiledPointLocation.h"
+#include "QueryCache.h"
+#include "ArrangementCompaction.h"
+#include "InstrumentedPointLocation.h"
+#include "VerticalDecomposition.h"
+#include "FrozenArrangement.h"
+#include "PersistentSlabPointLocation.h"
+#include "WindowQuery.h"
+
+// * Header that provides facilities for performing operations on file systems (std::filesystem::temp_directory_path).
+// * https://en.cppreference.com/w/cpp/filesystem
+#include <filesystem>
+
+namespace
+{
+	// Arrangement of the given number of seeded random segments.
+	Arrangement_2D BenchmarkArrangment(int nrOfSegments)
+	{
+		return BuildArrangmentWithHull(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, nrOfSegments, Benchmark_Seed), Vector_Point_2D());
+	}
+}
+
+// Naive and walk along line strategies have no search structure; for the others this measures attaching (building) it.
+// The search_structure_bytes counter is the heap growth of one attachment, measured outside the timed loop.
+template <class Strategy>
+static void BM_AttachPointLocation(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	std::unique_ptr<Strategy> measured;
+	size_t searchStructureBytes = MeasureSearchStructureBytes(arr, measured);
+	measured.reset();
+	for (auto _ : state)
+	{
+		Strategy pl(arr);
+		benchmark::ClobberMemory();
+	}
+	state.counters["edges"] = (double)arr.number_of_edges();
+	state.counters["search_structure_bytes"] = (double)searchStructureBytes;
+	state.counters["bytes_per_edge"] = arr.number_of_edges() == 0 ? 0 : (double)searchStructureBytes / arr.number_of_edges();
+}
+BENCHMARK_TEMPLATE(BM_AttachPointLocation, Naive_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AttachPointLocation, Walk_Along_Line_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AttachPointLocation, LandMarks_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AttachPointLocation, Trapezoid_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_AttachPointLocation, Persistent_Slab_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Arguments: number of segments; every iteration locates 10000 seeded query points.
+template <class Strategy>
+static void BM_Locate(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Strategy pl(arr);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = pl.locate(queries[i]);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	state.counters["edges"] = (double)arr.number_of_edges();
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK_TEMPLATE(BM_Locate, Naive_Point_Location)->RangeMultiplier(2)->Range(100, 400)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Locate, Walk_Along_Line_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Locate, LandMarks_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Locate, Trapezoid_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Locate, Persistent_Slab_Point_Location)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Convex hull containment through the arrangement of the hull edges and a trapezoidal map: the baseline of
+// BM_ConvexHullIndexBatchLocate (ConvexHullBenchmarks.cpp), on the same hull and query set. A query is inside when it is
+// not located in the unbounded face (points on the boundary count as inside, as ON_BOUNDARY does there).
+// Argument: number of queries.
+static void BM_LocateHullTrapezoid(benchmark::State& state)
+{
+	Vector_Point_2D convexHull = GrahamAndrew(GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, Hull_Benchmark_Points, Benchmark_Seed));
+	Arrangement_2D arr = BuildArrangmentWithHull(Vector_Line_Segment_2D(), convexHull);
+	Trapezoid_Point_Location pl(arr);
+	Vector_Point_2D queries = GenerateHullQueries((int)state.range(0));
+	size_t inside = 0;
+	for (auto _ : state)
+	{
+		inside = 0;
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = pl.locate(queries[i]);
+			const Face_handle* f = boost::get<Face_handle>(&result);
+			if (f == nullptr || !(*f)->is_unbounded())
+			{
+				inside++;
+			}
+		}
+	}
+	state.counters["hull_vertices"] = (double)convexHull.size();
+	state.counters["inside"] = (double)inside;
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_LocateHullTrapezoid)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// Landmark generators. Arguments: number of segments, Landmark_Generator, number of landmarks (0 = one per vertex).
+static void BM_AttachLandmarks(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	for (auto _ : state)
+	{
+		Landmarks_Index index(arr, (Landmark_Generator)state.range(1), (size_t)state.range(2));
+		benchmark::ClobberMemory();
+	}
+	state.SetLabel(LandmarkGeneratorName((Landmark_Generator)state.range(1)));
+	state.counters["vertices"] = (double)arr.number_of_vertices();
+}
+BENCHMARK(BM_AttachLandmarks)->ArgsProduct({ { 400, 800 }, { VERTICES_LANDMARKS, RANDOM_LANDMARKS, GRID_LANDMARKS, HALTON_LANDMARKS }, { 0, 256, 4096 } })->Unit(benchmark::kMillisecond);
+
+static void BM_LocateLandmarks(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Landmarks_Index index(arr, (Landmark_Generator)state.range(1), (size_t)state.range(2));
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = index.Locate(queries[i]);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	state.SetLabel(LandmarkGeneratorName((Landmark_Generator)state.range(1)));
+	state.counters["landmarks"] = (double)index.Landmarks();
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_LocateLandmarks)->ArgsProduct({ { 400, 800 }, { VERTICES_LANDMARKS, RANDOM_LANDMARKS, GRID_LANDMARKS, HALTON_LANDMARKS }, { 0, 256, 4096 } })->Unit(benchmark::kMillisecond);
+
+// Auto - tuning under a 20 ms build budget; reports the chosen configuration.
+static void BM_TuneLandmarks(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Vector_Point_2D sample = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 1000, Benchmark_Seed + 2);
+	Landmark_Tuning tuning;
+	for (auto _ : state)
+	{
+		tuning = TuneLandmarks(arr, sample, 0.02);
+	}
+	state.SetLabel(LandmarkGeneratorName(tuning.generator));
+	state.counters["landmarks"] = (double)tuning.landmarks;
+	state.counters["query_us"] = tuning.meanQuerySeconds * 1e6;
+}
+BENCHMARK(BM_TuneLandmarks)->Arg(400)->Arg(800)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+// Trapezoidal map: longest query path over 32 seeded builds, with and without CGAL's rebuild guarantees
+// (state.range(1)), and query latency on a build capped at the median depth.
+static void BM_TrapezoidDepthDistribution(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Trapezoid_Depth_Distribution distribution;
+	for (auto _ : state)
+	{
+		distribution = SampleTrapezoidDepths(arr, state.range(1) != 0, Benchmark_Seed, 32);
+	}
+	state.counters["depth_min"] = (double)distribution.min;
+	state.counters["depth_p50"] = (double)distribution.p50;
+	state.counters["depth_p99"] = (double)distribution.p99;
+	state.counters["depth_max"] = (double)distribution.max;
+}
+BENCHMARK(BM_TrapezoidDepthDistribution)->ArgsProduct({ { 400, 800 }, { 0, 1 } })->Unit(benchmark::kMillisecond)->Iterations(1);
+
+static void BM_LocateTrapezoidCapped(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Trapezoid_Options options = DefaultTrapezoidOptions();
+	options.seed = Benchmark_Seed;
+	options.maxQueryPathLength = SampleTrapezoidDepths(arr, true, Benchmark_Seed, 16).p50;
+	Trapezoid_Index index(arr, options);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = index.Locate(queries[i]);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	state.counters["longest_query_path"] = (double)index.Kept().longestQueryPath;
+	state.counters["builds"] = (double)index.Builds().size();
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_LocateTrapezoidCapped)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Tiled point location over 8x8 tiles written to disk. Arguments: number of segments, cache cap in KB. Queries are
+// spatially random, so the hit rate mostly reflects the fraction of tiles the cap keeps resident.
+static void BM_LocateTiled(benchmark::State& state)
+{
+	std::error_code error;
+	String directory = (std::filesystem::temp_directory_path(error) / ("tiled_benchmark_" + std::to_string(state.range(0)))).string();
+	if (error || !WriteTiles(GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed), 8, 8, directory))
+	{
+		state.SkipWithError("Unable to write the tiles to the temporary directory");
+		return;
+	}
+	Tiled_Point_Location<Trapezoid_Point_Location> tiled(directory, (size_t)state.range(1) << 10);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Tiled_Point_Location<Trapezoid_Point_Location>::Location location = tiled.Locate(queries[i]);
+			benchmark::DoNotOptimize(location.result);
+		}
+	}
+	const Tile_Cache_Stats& stats = tiled.Stats();
+	state.counters["hit_rate"] = stats.queries == 0 ? 0 : (double)stats.hits / stats.queries;
+	state.counters["evictions"] = (double)stats.evictions;
+	state.counters["peak_resident_bytes"] = (double)stats.peakResidentBytes;
+	state.SetItemsProcessed(state.iterations() * queries.size());
+	std::filesystem::remove_all(directory, error);
+}
+BENCHMARK(BM_LocateTiled)->ArgsProduct({ { 800, 3200 }, { 256, 4096, 1 << 20 } })->Unit(benchmark::kMillisecond);
+
+// Repeated queries, as from fixed sensors: 500 seeded points queried 20 times each per iteration. Arguments: number of
+// segments, cache tolerance (0: exact keys). The cache is kept across iterations, so after the first one every query hits.
+static void BM_LocateCached(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Query_Cache_Options options = DefaultQueryCacheOptions();
+	options.tolerance = (double)state.range(1);
+	Cached_Point_Location<Trapezoid_Point_Location> cached(arr, options);
+	Vector_Point_2D sensors = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 500, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		for (int r = 0; r < 20; r++)
+		{
+			for (int i = 0; i < sensors.size(); i++)
+			{
+				Location_Result_Type result = cached.Locate(sensors[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+	}
+	Query_Cache_Stats stats = cached.Stats();
+	size_t queries = stats.hits + stats.misses + stats.bypasses;
+	state.counters["hit_rate"] = queries == 0 ? 0 : (double)stats.hits / queries;
+	state.counters["entries"] = (double)stats.entries;
+	state.SetItemsProcessed(state.iterations() * 20 * sensors.size());
+}
+BENCHMARK(BM_LocateCached)->ArgsProduct({ { 400, 800 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+
+// Locating on a compacted arrangement. Arguments: number of segments, compact (0 or 1). The heap counters are taken
+// around the compaction pass; the compaction itself is outside the timed loop.
+static void BM_LocateCompacted(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	if (state.range(1))
+	{
+		Compaction_Report report = CompactArrangment(arr);
+		state.counters["heap_bytes_before"] = (double)report.heapBytesBefore;
+		state.counters["heap_bytes_after"] = (double)report.heapBytesAfter;
+		state.counters["double_vertices"] = (double)report.doubleVertices;
+	}
+	Trapezoid_Point_Location pl(arr);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = pl.locate(queries[i]);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_LocateCompacted)->ArgsProduct({ { 400, 800, 1600 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+
+// Instrumented queries. Arguments: number of segments, percentage of queries on edge midpoints (degenerate queries,
+// decided by exact predicates). The counters show the hit type mix, the suspected exact evaluations and the latency tail.
+template <class Strategy>
+static void BM_LocateInstrumented(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Instrumented_Point_Location<Strategy> pl(arr);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	Arrangement_2D::Edge_const_iterator edge = arr.edges_begin();
+	for (int i = 0; i < queries.size() && arr.number_of_edges() > 0; i++)
+	{
+		if (i % 100 < state.range(1))
+		{
+			queries[i] = CGAL::midpoint(edge->source()->point(), edge->target()->point());
+			if (++edge == arr.edges_end())
+			{
+				edge = arr.edges_begin();
+			}
+		}
+	}
+	for (auto _ : state)
+	{
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = pl.Locate(queries[i]);
+			benchmark::DoNotOptimize(result);
+		}
+	}
+	Point_Location_Stats stats = pl.Stats();
+	state.counters["edge_hits"] = stats.queries == 0 ? 0 : (double)stats.edgeHits / stats.queries;
+	state.counters["suspected_exact_queries"] = stats.queries == 0 ? 0 : (double)stats.suspectedExactQueries / stats.queries;
+	state.counters["p50_ns"] = LatencyQuantileNanoseconds(stats, 0.5);
+	state.counters["p99_ns"] = LatencyQuantileNanoseconds(stats, 0.99);
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK_TEMPLATE(BM_LocateInstrumented, Walk_Along_Line_Point_Location)->ArgsProduct({ { 400, 800 }, { 0, 10, 50 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_LocateInstrumented, LandMarks_Point_Location)->ArgsProduct({ { 400, 800 }, { 0, 10, 50 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_LocateInstrumented, Trapezoid_Point_Location)->ArgsProduct({ { 400, 800 }, { 0, 10, 50 } })->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_LocateInstrumented, Persistent_Slab_Point_Location)->ArgsProduct({ { 400, 800 }, { 0, 10, 50 } })->Unit(benchmark::kMillisecond);
+
+// Batch vertical ray shooting upwards. Argument: number of segments.
+template <class Strategy>
+static void BM_ShootVerticalRays(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Strategy pl(arr);
+	Arrangement_Index index(arr);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	for (auto _ : state)
+	{
+		std::vector<Vertical_Ray_Hit> hits = ShootVerticalRays(pl, index, queries, RAY_UP);
+		benchmark::DoNotOptimize(hits.data());
+	}
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK_TEMPLATE(BM_ShootVerticalRays, Trapezoid_Point_Location)->Arg(400)->Arg(800)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ShootVerticalRays, Walk_Along_Line_Point_Location)->Arg(400)->Arg(800)->Unit(benchmark::kMillisecond);
+
+// Export of the vertical decomposition as flat arrays. Argument: number of segments.
+static void BM_DecomposeArrangment(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Arrangement_Index index(arr);
+	size_t trapezoids = 0;
+	for (auto _ : state)
+	{
+		Vertical_Decomposition decomposition = DecomposeArrangment(arr, index);
+		trapezoids = decomposition.face.size();
+		benchmark::DoNotOptimize(decomposition.face.data());
+	}
+	state.counters["trapezoids"] = (double)trapezoids;
+}
+BENCHMARK(BM_DecomposeArrangment)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMillisecond);
+
+// Queries on a frozen arrangement, shared by all the threads without locks. Arguments: number of segments, number of
+// threads. The frozen_bytes counter is the size of its serialized blob.
+static void BM_LocateFrozen(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Frozen_Arrangement frozen = FreezeArrangment(arr);
+	Vector_Point_2D queries = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 100000, Benchmark_Seed + 1);
+	std::vector<double> points;
+	points.reserve(2 * queries.size());
+	for (int i = 0; i < queries.size(); i++)
+	{
+		points.push_back(CGAL::to_double(queries[i].x()));
+		points.push_back(CGAL::to_double(queries[i].y()));
+	}
+	for (auto _ : state)
+	{
+		std::vector<Frozen_Location> locations = LocateFrozenParallel(frozen, points, (unsigned int)state.range(1));
+		benchmark::DoNotOptimize(locations.data());
+	}
+	state.counters["frozen_bytes"] = (double)SerializeFrozenArrangment(frozen).size();
+	state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_LocateFrozen)->ArgsProduct({ { 400, 800 }, { 1, 2, 4, 8 } })->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_FreezeArrangment(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	for (auto _ : state)
+	{
+		Frozen_Arrangement frozen = FreezeArrangment(arr);
+		benchmark::DoNotOptimize(frozen.slabHalfEdges.data());
+	}
+}
+BENCHMARK(BM_FreezeArrangment)->Arg(400)->Arg(800)->Unit(benchmark::kMillisecond);
+
+// Window queries, as a tile server issues them. Arguments: number of segments, window side, number of threads.
+static void BM_QueryWindows(benchmark::State& state)
+{
+	Arrangement_2D arr = BenchmarkArrangment((int)state.range(0));
+	Frozen_Arrangement frozen = FreezeArrangment(arr);
+	Window_Index index(frozen);
+	double side = (double)state.range(1);
+	Vector_Point_2D corners = GeneratePoints2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, 10000, Benchmark_Seed + 1);
+	std::vector<CGAL::Bbox_2> windows;
+	for (int i = 0; i < corners.size(); i++)
+	{
+		double x = CGAL::to_double(corners[i].x());
+		double y = CGAL::to_double(corners[i].y());
+		windows.push_back(CGAL::Bbox_2(x, y, x + side, y + side));
+	}
+	size_t edges = 0;
+	for (auto _ : state)
+	{
+		std::vector<Window_Query_Result> results = QueryWindows(index, windows, (unsigned int)state.range(2));
+		edges = 0;
+		for (size_t i = 0; i < results.size(); i++)
+		{
+			edges += results[i].edges.size();
+		}
+	}
+	state.counters["edges_per_window"] = (double)edges / windows.size();
+	state.SetItemsProcessed(state.iterations() * windows.size());
+}
+BENCHMARK(BM_QueryWindows)->ArgsProduct({ { 800 }, { 100, 1000 }, { 1, 4 } })->Unit(benchmark::kMillisecond)->UseRealTime();
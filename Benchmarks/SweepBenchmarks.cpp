@@ -0,0 +1,179 @@
+// Segment intersection benchmarks: the surface sweep of the Plane Sweep lab (EPECK) and the integer coordinate policy.
+
+// Google Benchmark
+// https://github.com/google/benchmark/blob/main/docs/user_guide.md
+#include <benchmark/benchmark.h>
+
+#include "BenchmarkData.h"
+#include "PlaneSweep.h"
+#include "IntegerKernel.h"
+
+static void BM_FindSegmentLineIntersection(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	size_t nrOfIntersections = 0;
+	for (auto _ : state)
+	{
+		Vector_Point_2D intersectionPoints = findSegmentLineIntersection(segments);
+		nrOfIntersections = intersectionPoints.size();
+	}
+	state.counters["intersections"] = (double)nrOfIntersections;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindSegmentLineIntersection)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_FindSegmentLineIntersectionFlat(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	size_t nrOfIntersections = 0;
+	for (auto _ : state)
+	{
+		nrOfIntersections = findSegmentLineIntersectionFlat(segments).size();
+	}
+	state.counters["intersections"] = (double)nrOfIntersections;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindSegmentLineIntersectionFlat)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Large inputs of short segments (about one intersection per segment): surface sweep against the flat sweep, up to 10^6
+// segments.
+static void BM_FindSegmentLineIntersectionShort(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateShortSegments((int)state.range(0), 20);
+	size_t nrOfIntersections = 0;
+	for (auto _ : state)
+	{
+		nrOfIntersections = findSegmentLineIntersection(segments).size();
+	}
+	state.counters["intersections"] = (double)nrOfIntersections;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindSegmentLineIntersectionShort)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_FindSegmentLineIntersectionFlatShort(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateShortSegments((int)state.range(0), 20);
+	size_t nrOfIntersections = 0;
+	for (auto _ : state)
+	{
+		nrOfIntersections = findSegmentLineIntersectionFlat(segments).size();
+	}
+	state.counters["intersections"] = (double)nrOfIntersections;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindSegmentLineIntersectionFlatShort)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+// Predicate only modes: validating a clean (planar) input, and counting the intersecting pairs of the random instance.
+static void BM_AnySegmentLineIntersectionPlanar(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GeneratePlanarSegments((int)state.range(0));
+	bool found = false;
+	for (auto _ : state)
+	{
+		found = anySegmentLineIntersection(segments);
+	}
+	state.counters["found"] = found ? 1 : 0;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AnySegmentLineIntersectionPlanar)->RangeMultiplier(4)->Range(100, 102400)->Unit(benchmark::kMillisecond);
+
+static void BM_FindSegmentLineIntersectionPlanar(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GeneratePlanarSegments((int)state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(findSegmentLineIntersection(segments));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FindSegmentLineIntersectionPlanar)->RangeMultiplier(4)->Range(100, 102400)->Unit(benchmark::kMillisecond);
+
+static void BM_AnySegmentLineIntersection(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(anySegmentLineIntersection(segments));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AnySegmentLineIntersection)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_CountSegmentLineIntersections(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	size_t nrOfPairs = 0;
+	for (auto _ : state)
+	{
+		nrOfPairs = countSegmentLineIntersections(segments);
+	}
+	state.counters["pairs"] = (double)nrOfPairs;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountSegmentLineIntersections)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+// Same instance as BM_FindSegmentLineIntersectionShort: about one intersecting pair per segment, so the count is output
+// sensitive in the regime where the sweep structures dominate.
+static void BM_CountSegmentLineIntersectionsShort(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateShortSegments((int)state.range(0), 20);
+	size_t nrOfPairs = 0;
+	for (auto _ : state)
+	{
+		nrOfPairs = countSegmentLineIntersections(segments);
+	}
+	state.counters["pairs"] = (double)nrOfPairs;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CountSegmentLineIntersectionsShort)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+// Index pair report: topology only (state.range(1) == 0) or with every intersection point constructed on demand.
+static void BM_SegmentIntersectionReport(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateLineSegments2DInstance(Benchmark_Min_Bound, Benchmark_Max_Bound, (int)state.range(0), Benchmark_Seed);
+	size_t nrOfConstructions = 0;
+	for (auto _ : state)
+	{
+		Segment_Intersection_Report report(segments);
+		if (state.range(1) != 0)
+		{
+			benchmark::DoNotOptimize(report.Points());
+		}
+		nrOfConstructions = report.Constructions();
+	}
+	state.counters["constructions"] = (double)nrOfConstructions;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SegmentIntersectionReport)->ArgsProduct({ { 100, 200, 400, 800 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+
+// Same integer instance on both kernels.
+static void BM_ComputeIntersectionPointsIntegerInput(benchmark::State& state)
+{
+	Vector_Line_Segment_2D segments = GenerateIntegerSegments((int)state.range(0));
+	size_t nrOfIntersections = 0;
+	for (auto _ : state)
+	{
+		nrOfIntersections = ComputeIntersectionPoints<Epeck_Coordinates>(segments).size();
+	}
+	state.counters["intersections"] = (double)nrOfIntersections;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComputeIntersectionPointsIntegerInput)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
+
+static void BM_ComputeIntersectionPointsIntegerKernel(benchmark::State& state)
+{
+	Vector_Integer_Segment_2D segments;
+	if (!ConvertToIntegerSegments<Integer_Coordinates<>>(GenerateIntegerSegments((int)state.range(0)), segments))
+	{
+		state.SkipWithError("Instance is not representable by the integer kernel");
+		return;
+	}
+	size_t nrOfIntersections = 0;
+	for (auto _ : state)
+	{
+		nrOfIntersections = ComputeIntersectionPoints<Integer_Coordinates<>>(segments).size();
+	}
+	state.counters["intersections"] = (double)nrOfIntersections;
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComputeIntersectionPointsIntegerKernel)->RangeMultiplier(2)->Range(100, 800)->Unit(benchmark::kMillisecond);
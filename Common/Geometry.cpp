@@ -0,0 +1,123 @@
+// Linker to Header File
+#include "Geometry.h"
+
+namespace
+{
+	template <class Engine>
+	Vector_Point_2D GeneratePoints(int minBound, int maxBound, int nrOfElements, Engine& randomEngine)
+	{
+		// This distribution (also know as rectangular distribution) produces random numbers in a range [a,b)
+		// where all intervals of the same length within it are equally probable.
+		// https://www.cplusplus.com/reference/random/uniform_real_distribution/
+		std::uniform_real_distribution<> rectangularDistribution(minBound, maxBound);
+
+		Vector_Point_2D randomPoints;
+
+		for (int n = 0; n < nrOfElements; n++)
+		{
+			double x;
+			double y;
+			x = rectangularDistribution(randomEngine);
+			y = rectangularDistribution(randomEngine);
+
+			// vector::push_back(<T> value)
+			// Adds a new element at the end of the vector, after its current last element. The content of val is copied (or moved) to the new element.
+			// https://www.cplusplus.com/reference/vector/vector/push_back/
+			randomPoints.push_back(Point_2D(x, y));
+		}
+		return randomPoints;
+	}
+
+	template <class Engine>
+	Vector_Line_Segment_2D GenerateLineSegments(int minBound, int maxBound, int nrOfElements, Engine& randomEngine)
+	{
+		std::uniform_real_distribution<> rectangularDistribution(minBound, maxBound);
+
+		Vector_Line_Segment_2D randomSegments;
+
+		for (int n = 0; n < nrOfElements; n++)
+		{
+			double x1;
+			double y1;
+
+			double x2;
+			double y2;
+
+			x1 = rectangularDistribution(randomEngine);
+			y1 = rectangularDistribution(randomEngine);
+
+			x2 = rectangularDistribution(randomEngine);
+			y2 = rectangularDistribution(randomEngine);
+
+			Line_Segment_2D segment = Line_Segment_2D(Point_2D(x1, y1), Point_2D(x2, y2));
+			randomSegments.push_back(segment);
+		}
+		return randomSegments;
+	}
+}
+
+Vector_Point_2D GeneratePoints2DInstance(int minBound, int maxBound, int nrOfElements)
+{
+	// A random number generator that produces non-deterministic random numbers, if supported.
+	// Unlike the other standard generators, this is not meant to be an engine that generates pseudo - random numbers,
+	// but a generator based on stochastic processes to generate a sequence of uniformly distributed random numbers.
+	// https://www.cplusplus.com/reference/random/random_device/
+	std::random_device randomDevice;
+
+	// This is a random number engine class that generates pseudo-random numbers.
+	// It is the library implemention's selection of a generator that provides at least acceptable
+	// engine behavior for relatively casual, inexpert, and/or lightweight use.
+	// https://www.cplusplus.com/reference/random/default_random_engine/
+	std::default_random_engine randomEngine(randomDevice());
+
+	return GeneratePoints(minBound, maxBound, nrOfElements, randomEngine);
+}
+
+Vector_Point_2D GeneratePoints2DInstance(int minBound, int maxBound, int nrOfElements, unsigned int seed)
+{
+	// Mersenne Twister 19937 generator: unlike default_random_engine, its sequence for a given seed is fixed by the
+	// standard, so seeded instances are identical across compilers and platforms.
+	// https://www.cplusplus.com/reference/random/mt19937/
+	std::mt19937 randomEngine(seed);
+
+	return GeneratePoints(minBound, maxBound, nrOfElements, randomEngine);
+}
+
+Vector_Line_Segment_2D GenerateLineSegments2DInstance(int minBound, int maxBound, int nrOfElements)
+{
+	std::random_device randomDevice;
+	std::default_random_engine randomEngine(randomDevice());
+
+	return GenerateLineSegments(minBound, maxBound, nrOfElements, randomEngine);
+}
+
+Vector_Line_Segment_2D GenerateLineSegments2DInstance(int minBound, int maxBound, int nrOfElements, unsigned int seed)
+{
+	std::mt19937 randomEngine(seed);
+
+	return GenerateLineSegments(minBound, maxBound, nrOfElements, randomEngine);
+}
+
+void DisplayPoints(Vector_Point_2D vector, int precission)
+{
+	// std::fixed
+	// Use fixed floating-point notation (function )
+	// std::setprecision(int)
+	// Sets the decimal precision to be used to format floating - point values on output operations.
+	// https://www.cplusplus.com/reference/iomanip/setprecision/
+	for (int i = 0; i < vector.size(); i++)
+	{
+		std::cout << std::fixed << std::setprecision(precission) << "(" << vector[i][0] << "," << vector[i][1] << ")" << std::endl;
+	}
+}
+
+void DisplayLineSegments(Vector_Line_Segment_2D LineSegments, int precission)
+{
+	for (int i = 0; i < LineSegments.size(); i++)
+	{
+		Point_2D pointSource = LineSegments[i].source();
+		Point_2D pointTarget = LineSegments[i].target();
+		std::cout << std::fixed << std::setprecision(precission) << "Line segment: source (" << pointSource.x() << "," << pointSource.y() << "), target (" << pointTarget.x() << ","
+			<< pointTarget.y() << ")" << std::endl;
+	}
+}
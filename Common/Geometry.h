@@ -0,0 +1,94 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Common geometry types and helpers shared by the Labs and the Semester Project.
+
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+// General C++ Standard Libraries
+// * Header that defines the standard input/output stream objects
+#include <iostream>
+
+// * Vectors are sequence containers representing arrays that can change in size.
+// * https://www.cplusplus.com/reference/vector/vector/
+#include <vector>
+
+// * This header introduces random number generation facilities.
+// * https://www.cplusplus.com/reference/random/
+#include <random>
+
+// * Header providing parametric manipulators :
+// * https://www.cplusplus.com/reference/iomanip/
+#include <iomanip>
+
+// * Header responsible for support of strings: objects that represent sequences of characters.
+// * https://www.cplusplus.com/reference/string/string/
+#include <string>
+// --------------------------------------------------------------------
+
+// Predefined Kernel:
+// * Exact Geometric Predicates Exact Geometric Constructions
+// * It uses Cartesian representation.
+// * It supports constructions of points from double Cartesian coordinates.
+// * It provides both exact geometric predicates and exact geometric constructions.
+// * https://doc.cgal.org/latest/Kernel_23/classCGAL_1_1Exact__predicates__exact__constructions__kernel.html
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+// --------------------------------------------------------------------
+
+// Naming Conventions for simplicity
+// * Kernel : CGAL::Exact_predicates_exact_constructions_kernel
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+
+// * Point_2D : Kernel::Point_2
+typedef Kernel::Point_2 Point_2D;
+
+// * Line_Segment_2D : Kernel::Segment_2
+typedef Kernel::Segment_2 Line_Segment_2D;
+
+// * Vector_2D : std::vector<Point_2D>
+typedef std::vector<Point_2D> Vector_Point_2D;
+
+// * Vector_2D : std::vector<Point_2D>
+typedef std::vector<Line_Segment_2D> Vector_Line_Segment_2D;
+
+// String: std::basic_string<char>
+typedef std::basic_string<char> String;
+// --------------------------------------------------------------------
+
+/*
+* This function is responsible for generating a random set of 2D points using the rectangular distribution.
+* It takes as input parameters the minimum bound, the maximum bound as well as the number of desired points
+* to be generated and returns a vector of 2D - points containing elements in range [a,b)x[a,b).
+*/
+Vector_Point_2D GeneratePoints2DInstance(int minBound, int maxBound, int nrOfElements);
+
+/*
+* Same as above, but the points are drawn from a pseudo - random engine initialized with the given seed,
+* so the same seed always generates the same instance (used by the benchmarks).
+*/
+Vector_Point_2D GeneratePoints2DInstance(int minBound, int maxBound, int nrOfElements, unsigned int seed);
+
+/*
+* This function is responsible for generating a random set of 2D line segments using the rectangular distribution.
+* It takes as input parameters the minimum bound, the maximum bound as well as the number of desired segments
+* to be generated and returns a vector of 2D - line segments containing elements in range ([a,b)x[a,b), [a,b)x[a,b)).
+*/
+Vector_Line_Segment_2D GenerateLineSegments2DInstance(int minBound, int maxBound, int nrOfElements);
+
+/*
+* Same as above, with a pseudo - random engine initialized with the given seed.
+*/
+Vector_Line_Segment_2D GenerateLineSegments2DInstance(int minBound, int maxBound, int nrOfElements, unsigned int seed);
+
+/*
+* This function is responsible for displaying in the screen a complete list of a 2D-points vector, given
+* the desired fixed precission.
+*/
+void DisplayPoints(Vector_Point_2D vector, int precission);
+
+/*
+* This function is responsible for displaying in the screen a complete list of a 2D-line segment vector, given
+* the desired fixed precission.
+*/
+void DisplayLineSegments(Vector_Line_Segment_2D LineSegments, int precission);
+#endif
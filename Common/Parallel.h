@@ -0,0 +1,92 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// * Vectors are sequence containers representing arrays that can change in size.
+// * https://www.cplusplus.com/reference/vector/vector/
+#include <vector>
+
+// * Class to represent individual threads of execution.
+// * https://www.cplusplus.com/reference/thread/thread/
+#include <thread>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that defines std::exception_ptr, used to carry an exception from a worker thread to the caller.
+// * https://www.cplusplus.com/reference/exception/exception_ptr/
+#include <exception>
+
+/*
+* This function is responsible for returning the number of worker threads to be used when the caller
+* asks for 0 (automatic) threads: the number of hardware threads, or 1 if it cannot be determined.
+*/
+inline unsigned int DefaultThreadCount()
+{
+	unsigned int nrOfThreads = std::thread::hardware_concurrency();
+	return nrOfThreads == 0 ? 1 : nrOfThreads;
+}
+
+/*
+* This function is responsible for splitting the index range [0, nrOfElements) into contiguous chunks and
+* calling function(begin, end, threadIndex) once per chunk, each chunk on its own thread. The calling thread
+* processes the last chunk itself. Ranges smaller than minChunk elements per thread use fewer threads, so
+* small batches do not pay for thread creation.
+* If function throws, on any thread, every worker is still joined and the first exception (in chunk order) is
+* rethrown on the calling thread.
+*/
+template <class Function>
+void ParallelFor(size_t nrOfElements, Function function, unsigned int nrOfThreads = 0, size_t minChunk = 1024)
+{
+	if (nrOfThreads == 0)
+	{
+		nrOfThreads = DefaultThreadCount();
+	}
+	size_t maxThreads = (nrOfElements + minChunk - 1) / minChunk;
+	nrOfThreads = (unsigned int)std::max<size_t>(1, std::min<size_t>(nrOfThreads, maxThreads));
+
+	size_t chunk = (nrOfElements + nrOfThreads - 1) / nrOfThreads;
+	std::vector<std::thread> workers;
+	std::vector<std::exception_ptr> errors(nrOfThreads);
+	for (unsigned int t = 0; t + 1 < nrOfThreads; t++)
+	{
+		size_t begin = t * chunk;
+		size_t end = std::min(nrOfElements, begin + chunk);
+		workers.emplace_back([&function, &errors, begin, end, t]()
+		{
+			try
+			{
+				function(begin, end, t);
+			}
+			catch (...)
+			{
+				errors[t] = std::current_exception();
+			}
+		});
+	}
+	size_t begin = std::min(nrOfElements, (size_t)(nrOfThreads - 1) * chunk);
+	try
+	{
+		function(begin, nrOfElements, nrOfThreads - 1);
+	}
+	catch (...)
+	{
+		errors[nrOfThreads - 1] = std::current_exception();
+	}
+
+	for (size_t t = 0; t < workers.size(); t++)
+	{
+		workers[t].join();
+	}
+	for (size_t t = 0; t < errors.size(); t++)
+	{
+		if (errors[t])
+		{
+			std::rethrow_exception(errors[t]);
+		}
+	}
+}
+#endif
@@ -1,100 +1,106 @@
-// Linker to Header File
-#include "ConvexHull.h"
-
-// General C++ Standard Libraries
-// * Header that defines the standard input/output stream objects
-#include <iostream>
-
-// * Vectors are sequence containers representing arrays that can change in size.
-// * https://www.cplusplus.com/reference/vector/vector/
-#include <vector>
-
-// * This header introduces random number generation facilities.
-// * https://www.cplusplus.com/reference/random/
-#include <random>
-
-// * Header providing parametric manipulators :
-// * https://www.cplusplus.com/reference/iomanip/
-#include <iomanip>
-
-// CGAL Convex Hull Libraries (2D)
-// https://doc.cgal.org/5.0.4/Convex_hull_2/
-
-// Predefined Kernel:
-// * Exact Geometric Predicates Inexact Geometric Constructions 
-// * It uses Cartesian representation.
-// * It supports constructions of points from double Cartesian coordinates.
-// * It provides exact geometric predicates, but inexact geometric constructions.
-// * https://doc.cgal.org/5.0.4/Kernel_23/classCGAL_1_1Exact__predicates__inexact__constructions__kernel.html
-#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
-
-// Graham - Andrew O(nlogn) Scan Algorithm
-// https://doc.cgal.org/5.0.4/Convex_hull_2/group__PkgConvexHull2Functions.html#gaeccc6dda2f9d3096c94a7ff84cc91a85
-#include <CGAL/ch_graham_andrew.h>
-
-// Naming Conventions for simplicity
-// * Kernel : CGAL::Exact_predicates_inexact_constructions_kernel
-typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
-
-// * Point_2D : CGAL::Exact_predicates_inexact_constructions_kernel
-typedef Kernel::Point_2 Point_2D;
-
-// * Vector_2D : std::vector<Point_2D>
-typedef std::vector<Point_2D> Vector_2D;
-
-Vector_2D GrahamAndrew(Vector_2D points)
-{
-	Vector_2D result;
-	CGAL::ch_graham_andrew(points.begin(), points.end(), std::back_inserter(result));
-	return result;
-}
-
-Vector_2D Generate2DInstance(int minBound, int maxBound, int nrOfElements)
-{
-	// A random number generator that produces non-deterministic random numbers, if supported.
-	// Unlike the other standard generators, this is not meant to be an engine that generates pseudo - random numbers, 
-	// but a generator based on stochastic processes to generate a sequence of uniformly distributed random numbers.
-	// https://www.cplusplus.com/reference/random/random_device/
-	std::random_device randomDevice;
-	
-	// This is a random number engine class that generates pseudo-random numbers.
-	// It is the library implemention's selection of a generator that provides at least acceptable 
-	// engine behavior for relatively casual, inexpert, and/or lightweight use.
-	// https://www.cplusplus.com/reference/random/default_random_engine/
-	std::default_random_engine randomEngine(randomDevice());
-
-	// This distribution (also know as rectangular distribution) produces random numbers in a range [a,b) 
-	// where all intervals of the same length within it are equally probable.
-	// https://www.cplusplus.com/reference/random/uniform_real_distribution/
-	std::uniform_real_distribution<> rectangularDistribution(minBound, maxBound);
-
-	// std::fixed
-	// Use fixed floating-point notation (function )
-	// std::setprecision(int)
-	// Sets the decimal precision to be used to format floating - point values on output operations.
-	// https://www.cplusplus.com/reference/iomanip/setprecision/
-
-	Vector_2D randomPoints;
-
-	for (int n = 0; n < nrOfElements; n++)
-	{
-		double x;
-		double y;
-		x = rectangularDistribution(randomEngine);
-		y = rectangularDistribution(randomEngine);
-		
-		// vector::push_back(<T> value)
-		// Adds a new element at the end of the vector, after its current last element. The content of val is copied (or moved) to the new element.
-		// https://www.cplusplus.com/reference/vector/vector/push_back/
-		randomPoints.push_back(Point_2D(x, y));
-	}
-	return randomPoints;
-}
-
-void DisplayVector(Vector_2D vector, int precission) 
-{
-	for (int i = 0; i < vector.size(); i++)
-	{
-		std::cout << std::fixed << std::setprecision(precission) << "(" << vector[i][0] << "," << vector[i][1] << ")" << std::endl;
-	}
-}
\ No newline at end of file
+// Linker to Header File
+#include "ConvexHull.h"
+
+Vector_Point_2D GrahamAndrew(Vector_Point_2D points)
+{
+	Vector_Point_2D result;
+	CGAL::ch_graham_andrew(points.begin(), points.end(), std::back_inserter(result));
+	return result;
+}
+
+namespace
+{
+	// Andrew's monotone chain over the points begin to end - 1, with their indices sorted in scratch and scanned in chain.
+	// The hull indices are written to hull (at most end - begin of them, counter - clockwise from the lexicographically
+	// smallest point) and their number is returned.
+	size_t MonotoneChain(const Vector_Point_2D& points, size_t begin, size_t end, std::vector<size_t>& scratch, std::vector<size_t>& chain, size_t* hull)
+	{
+		scratch.clear();
+		for (size_t i = begin; i < end; i++)
+		{
+			scratch.push_back(i);
+		}
+		std::sort(scratch.begin(), scratch.end(), [&](size_t a, size_t b)
+		{
+			return CGAL::compare_xy(points[a], points[b]) == CGAL::SMALLER;
+		});
+		scratch.erase(std::unique(scratch.begin(), scratch.end(), [&](size_t a, size_t b)
+		{
+			return CGAL::compare_xy(points[a], points[b]) == CGAL::EQUAL;
+		}), scratch.end());
+
+		size_t n = scratch.size();
+		if (n < 3)
+		{
+			std::copy(scratch.begin(), scratch.end(), hull);
+			return n;
+		}
+
+		// Lower hull from left to right, then upper hull from right to left; only strict left turns are kept.
+		chain.resize(2 * n);
+		size_t k = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			while (k >= 2 && CGAL::orientation(points[chain[k - 2]], points[chain[k - 1]], points[scratch[i]]) != CGAL::LEFT_TURN)
+			{
+				k--;
+			}
+			chain[k++] = scratch[i];
+		}
+		size_t lower = k + 1;
+		for (size_t i = n - 1; i > 0; i--)
+		{
+			while (k >= lower && CGAL::orientation(points[chain[k - 2]], points[chain[k - 1]], points[scratch[i - 1]]) != CGAL::LEFT_TURN)
+			{
+				k--;
+			}
+			chain[k++] = scratch[i - 1];
+		}
+		// The last point is the first one again. All collinear points leave only the two extreme ones.
+		k--;
+		std::copy(chain.begin(), chain.begin() + k, hull);
+		return k;
+	}
+}
+
+bool BatchGrahamAndrew(const Vector_Point_2D& points, const std::vector<size_t>& offsets, Vector_Point_2D& hulls, std::vector<size_t>& hullOffsets, unsigned int nrOfThreads)
+{
+	hulls.clear();
+	hullOffsets.clear();
+	if (offsets.empty() || offsets.front() != 0 || offsets.back() != points.size() || !std::is_sorted(offsets.begin(), offsets.end()))
+	{
+		return false;
+	}
+	size_t nrOfGroups = offsets.size() - 1;
+
+	// A hull has at most as many points as its group, so the hull indices of every group fit at the offset of the group.
+	std::vector<size_t> hullIndices(points.size());
+	std::vector<size_t> hullSizes(nrOfGroups);
+	ParallelFor(nrOfGroups, [&](size_t begin, size_t end, unsigned int)
+	{
+		std::vector<size_t> scratch;
+		std::vector<size_t> chain;
+		for (size_t g = begin; g < end; g++)
+		{
+			hullSizes[g] = MonotoneChain(points, offsets[g], offsets[g + 1], scratch, chain, hullIndices.data() + offsets[g]);
+		}
+	}, nrOfThreads);
+
+	hullOffsets.resize(nrOfGroups + 1);
+	hullOffsets[0] = 0;
+	for (size_t g = 0; g < nrOfGroups; g++)
+	{
+		hullOffsets[g + 1] = hullOffsets[g] + hullSizes[g];
+	}
+
+	// Copying a point copies a reference counted handle, which must not happen on several threads at once.
+	hulls.reserve(hullOffsets.back());
+	for (size_t g = 0; g < nrOfGroups; g++)
+	{
+		for (size_t k = 0; k < hullSizes[g]; k++)
+		{
+			hulls.push_back(points[hullIndices[offsets[g] + k]]);
+		}
+	}
+	return true;
+}
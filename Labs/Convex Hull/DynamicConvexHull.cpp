@@ -0,0 +1,384 @@
+// Linker to Header File
+#include "DynamicConvexHull.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+Dynamic_Convex_Hull::Dynamic_Convex_Hull() : root(-1), nrOfPoints(0)
+{
+}
+
+bool Dynamic_Convex_Hull::IsLeaf(int v) const
+{
+	return nodes[v].left == -1;
+}
+
+bool Dynamic_Convex_Hull::Less(int leafA, int leafB) const
+{
+	return CGAL::compare_xy(nodes[leafA].point, nodes[leafB].point) == CGAL::SMALLER;
+}
+
+CGAL::Orientation Dynamic_Convex_Hull::Orientation(const Point_2D& p, const Point_2D& q, const Point_2D& r, Side side) const
+{
+	// The lower hull is the upper hull seen upside down: swapping two points flips the orientation.
+	return side == UPPER ? CGAL::orientation(p, q, r) : CGAL::orientation(p, r, q);
+}
+
+int Dynamic_Convex_Hull::Tangent(int v, const Point_2D& q, Side side) const
+{
+	// Binary search over the hull of v for the vertex t such that the hull lies below (above, for the lower hull) the line
+	// through t and q, where q is to the right of every point of v. The search follows the bridges of the tree: [lo, hi]
+	// is the part of the hull of the current node that belongs to the hull of v (-1 for no bound). Once the bridge of the
+	// current node lies within it, the bridge is an edge of the hull of v and tells on which side of it t lies. Among
+	// collinear candidates the leftmost one is returned.
+	int lo = -1;
+	int hi = -1;
+	while (!IsLeaf(v))
+	{
+		int a = nodes[v].bridgeLeft[side];
+		int b = nodes[v].bridgeRight[side];
+		if (hi != -1 && Less(hi, b))
+		{
+			v = nodes[v].left;
+		}
+		else if (lo != -1 && Less(a, lo))
+		{
+			v = nodes[v].right;
+		}
+		else if (Orientation(nodes[a].point, nodes[b].point, q, side) != CGAL::RIGHT_TURN)
+		{
+			hi = a;
+			v = nodes[v].left;
+		}
+		else
+		{
+			lo = b;
+			v = nodes[v].right;
+		}
+	}
+	return v;
+}
+
+void Dynamic_Convex_Hull::Bridge(int v, Side side)
+{
+	// Binary search over the hull of the right child for the right end q of the bridge: for an edge (q1, q2) of that hull,
+	// q lies at or after q2 if and only if q2 is not below the tangent from q1 to the hull of the left child. Among
+	// collinear candidates the rightmost one is taken, so that the hull keeps no collinear points.
+	int left = nodes[v].left;
+	int w = nodes[v].right;
+	int lo = -1;
+	int hi = -1;
+	while (!IsLeaf(w))
+	{
+		int a = nodes[w].bridgeLeft[side];
+		int b = nodes[w].bridgeRight[side];
+		if (hi != -1 && Less(hi, b))
+		{
+			w = nodes[w].left;
+		}
+		else if (lo != -1 && Less(a, lo))
+		{
+			w = nodes[w].right;
+		}
+		else
+		{
+			int t = Tangent(left, nodes[a].point, side);
+			if (Orientation(nodes[t].point, nodes[a].point, nodes[b].point, side) != CGAL::RIGHT_TURN)
+			{
+				lo = b;
+				w = nodes[w].right;
+			}
+			else
+			{
+				hi = a;
+				w = nodes[w].left;
+			}
+		}
+	}
+	nodes[v].bridgeRight[side] = w;
+	nodes[v].bridgeLeft[side] = Tangent(left, nodes[w].point, side);
+}
+
+void Dynamic_Convex_Hull::Update(int v)
+{
+	if (IsLeaf(v))
+	{
+		nodes[v].height = 0;
+		nodes[v].maxLeaf = v;
+		return;
+	}
+	nodes[v].height = 1 + std::max(nodes[nodes[v].left].height, nodes[nodes[v].right].height);
+	nodes[v].maxLeaf = nodes[nodes[v].right].maxLeaf;
+	Bridge(v, UPPER);
+	Bridge(v, LOWER);
+}
+
+void Dynamic_Convex_Hull::Replace(int v, int w)
+{
+	int parent = nodes[v].parent;
+	nodes[w].parent = parent;
+	if (parent == -1)
+	{
+		root = w;
+	}
+	else if (nodes[parent].left == v)
+	{
+		nodes[parent].left = w;
+	}
+	else
+	{
+		nodes[parent].right = w;
+	}
+}
+
+int Dynamic_Convex_Hull::Rotate(int v, bool toLeft)
+{
+	int u = toLeft ? nodes[v].right : nodes[v].left;
+	int middle = toLeft ? nodes[u].left : nodes[u].right;
+	Replace(v, u);
+	if (toLeft)
+	{
+		nodes[v].right = middle;
+		nodes[u].left = v;
+	}
+	else
+	{
+		nodes[v].left = middle;
+		nodes[u].right = v;
+	}
+	nodes[middle].parent = v;
+	nodes[v].parent = u;
+	Update(v);
+	Update(u);
+	return u;
+}
+
+void Dynamic_Convex_Hull::Rebalance(int v)
+{
+	while (v != -1)
+	{
+		Update(v);
+		int balance = nodes[nodes[v].left].height - nodes[nodes[v].right].height;
+		if (balance > 1)
+		{
+			int left = nodes[v].left;
+			if (nodes[nodes[left].left].height < nodes[nodes[left].right].height)
+			{
+				Rotate(left, true);
+			}
+			v = Rotate(v, false);
+		}
+		else if (balance < -1)
+		{
+			int right = nodes[v].right;
+			if (nodes[nodes[right].right].height < nodes[nodes[right].left].height)
+			{
+				Rotate(right, false);
+			}
+			v = Rotate(v, true);
+		}
+		v = nodes[v].parent;
+	}
+}
+
+int Dynamic_Convex_Hull::NewNode()
+{
+	int v;
+	if (freeNodes.empty())
+	{
+		v = (int)nodes.size();
+		nodes.push_back(Node());
+	}
+	else
+	{
+		v = freeNodes.back();
+		freeNodes.pop_back();
+	}
+	nodes[v].left = -1;
+	nodes[v].right = -1;
+	nodes[v].parent = -1;
+	nodes[v].height = 0;
+	nodes[v].maxLeaf = v;
+	nodes[v].count = 0;
+	return v;
+}
+
+bool Dynamic_Convex_Hull::Insert(const Point_2D& point)
+{
+	nrOfPoints++;
+	if (root == -1)
+	{
+		root = NewNode();
+		nodes[root].point = point;
+		nodes[root].count = 1;
+		return true;
+	}
+
+	int v = root;
+	while (!IsLeaf(v))
+	{
+		int left = nodes[v].left;
+		v = CGAL::compare_xy(point, nodes[nodes[left].maxLeaf].point) == CGAL::LARGER ? nodes[v].right : left;
+	}
+	CGAL::Comparison_result comparison = CGAL::compare_xy(point, nodes[v].point);
+	if (comparison == CGAL::EQUAL)
+	{
+		nodes[v].count++;
+		return false;
+	}
+
+	int leaf = NewNode();
+	int internal = NewNode();
+	nodes[leaf].point = point;
+	nodes[leaf].count = 1;
+	Replace(v, internal);
+	nodes[internal].left = comparison == CGAL::SMALLER ? leaf : v;
+	nodes[internal].right = comparison == CGAL::SMALLER ? v : leaf;
+	nodes[leaf].parent = internal;
+	nodes[v].parent = internal;
+	Rebalance(internal);
+	return true;
+}
+
+bool Dynamic_Convex_Hull::Remove(const Point_2D& point)
+{
+	if (root == -1)
+	{
+		return false;
+	}
+	int v = root;
+	while (!IsLeaf(v))
+	{
+		int left = nodes[v].left;
+		v = CGAL::compare_xy(point, nodes[nodes[left].maxLeaf].point) == CGAL::LARGER ? nodes[v].right : left;
+	}
+	if (CGAL::compare_xy(point, nodes[v].point) != CGAL::EQUAL)
+	{
+		return false;
+	}
+
+	nrOfPoints--;
+	if (--nodes[v].count > 0)
+	{
+		return true;
+	}
+	freeNodes.push_back(v);
+	if (v == root)
+	{
+		root = -1;
+		return true;
+	}
+
+	// The parent is replaced by the sibling of the removed leaf.
+	int parent = nodes[v].parent;
+	int sibling = nodes[parent].left == v ? nodes[parent].right : nodes[parent].left;
+	Replace(parent, sibling);
+	freeNodes.push_back(parent);
+	Rebalance(nodes[sibling].parent);
+	return true;
+}
+
+size_t Dynamic_Convex_Hull::Size() const
+{
+	return nrOfPoints;
+}
+
+int Dynamic_Convex_Hull::Height() const
+{
+	return root == -1 ? 0 : nodes[root].height;
+}
+
+void Dynamic_Convex_Hull::Chain(int v, int lo, int hi, Side side, Vector_Point_2D& chain) const
+{
+	// The part [lo, hi] of the hull of v: the hull of the left child up to the bridge, then the hull of the right child.
+	if (IsLeaf(v))
+	{
+		chain.push_back(nodes[v].point);
+		return;
+	}
+	int a = nodes[v].bridgeLeft[side];
+	int b = nodes[v].bridgeRight[side];
+	if (lo == -1 || !Less(a, lo))
+	{
+		Chain(nodes[v].left, lo, (hi != -1 && Less(hi, a)) ? hi : a, side, chain);
+	}
+	if (hi == -1 || !Less(hi, b))
+	{
+		Chain(nodes[v].right, (lo != -1 && Less(b, lo)) ? lo : b, hi, side, chain);
+	}
+}
+
+Vector_Point_2D Dynamic_Convex_Hull::UpperHull() const
+{
+	Vector_Point_2D chain;
+	if (root != -1)
+	{
+		Chain(root, -1, -1, UPPER, chain);
+	}
+	return chain;
+}
+
+Vector_Point_2D Dynamic_Convex_Hull::LowerHull() const
+{
+	Vector_Point_2D chain;
+	if (root != -1)
+	{
+		Chain(root, -1, -1, LOWER, chain);
+	}
+	return chain;
+}
+
+Vector_Point_2D Dynamic_Convex_Hull::Hull() const
+{
+	// Lower hull from left to right, then the upper hull back from right to left without its end points.
+	Vector_Point_2D hull = LowerHull();
+	Vector_Point_2D upper = UpperHull();
+	for (int i = (int)upper.size() - 2; i > 0; i--)
+	{
+		hull.push_back(upper[i]);
+	}
+	return hull;
+}
+
+bool CrossCheckDynamicConvexHull(int nrOfOperations, unsigned int seed)
+{
+	std::mt19937 randomEngine(seed);
+	std::uniform_int_distribution<int> coordinate(0, 15);
+	std::uniform_int_distribution<int> operation(0, 9);
+
+	Dynamic_Convex_Hull dynamicHull;
+	Vector_Point_2D points;
+	for (int i = 0; i < nrOfOperations; i++)
+	{
+		// Inserts outnumber deletions while the set is small, so the set grows to a few dozen points and then stays there.
+		bool insert = points.empty() || operation(randomEngine) < (points.size() < 40 ? 7 : 4);
+		if (insert)
+		{
+			Point_2D point(coordinate(randomEngine), coordinate(randomEngine));
+			dynamicHull.Insert(point);
+			points.push_back(point);
+		}
+		else
+		{
+			std::uniform_int_distribution<size_t> index(0, points.size() - 1);
+			size_t removed = index(randomEngine);
+			dynamicHull.Remove(points[removed]);
+			points[removed] = points.back();
+			points.pop_back();
+		}
+
+		Vector_Point_2D expected = GrahamAndrew(points);
+		Vector_Point_2D found = dynamicHull.Hull();
+		if (found != expected || dynamicHull.Size() != points.size())
+		{
+			std::cout << "Dynamic convex hull mismatch after operation " << i << (insert ? " (insert)" : " (remove)") << std::endl;
+			std::cout << "Expected:" << std::endl;
+			DisplayPoints(expected, 3);
+			std::cout << "Found:" << std::endl;
+			DisplayPoints(found, 3);
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,110 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Fully dynamic convex hull: Overmars - van Leeuwen bridge tree
+// https://doi.org/10.1016/0022-0000(81)90012-X
+
+#ifndef DYNAMIC_CONVEX_HULL_H
+#define DYNAMIC_CONVEX_HULL_H
+
+// Linker to Convex Hull Header File (GrahamAndrew, used by the cross check)
+#include "ConvexHull.h"
+
+// --------------------------------------------------------------------
+
+/*
+* This class is responsible for maintaining the convex hull of a set of 2D points under insertions and deletions.
+* The points are the leaves of a balanced (AVL) binary tree, in lexicographic (x, y) order. Every internal node stores
+* the bridges of its two children: the edges joining the upper hull (and the lower hull) of its left subtree to the upper
+* (lower) hull of its right subtree. The hull of a node is therefore implicit: the hull of its left child up to the left
+* end of the bridge, followed by the hull of its right child from the right end of the bridge.
+* A bridge is found by a binary search over the implicit hull of the right child, which calls a tangent search over the
+* implicit hull of the left child at every step, so Insert and Remove recompute the O(log n) bridges of the path to the
+* root in O(log^3 n) time. Hull walks the implicit hulls in O(h log n) time for a hull of h points.
+* Equal points are kept once, with a count. The hull has no collinear points and matches GrahamAndrew.
+* Example: Dynamic_Convex_Hull hull; hull.Insert(p); hull.Remove(q); Vector_Point_2D points = hull.Hull();
+*/
+class Dynamic_Convex_Hull
+{
+public:
+	Dynamic_Convex_Hull();
+
+	/*
+	* Adds the given point. Returns false if an equal point was already in the set (its count is incremented).
+	*/
+	bool Insert(const Point_2D& point);
+
+	/*
+	* Removes one copy of the given point. Returns false if it is not in the set.
+	*/
+	bool Remove(const Point_2D& point);
+
+	/*
+	* Number of points in the set, copies included.
+	*/
+	size_t Size() const;
+
+	/*
+	* The extreme points of the set in counter - clockwise order, from the lexicographically smallest one (as GrahamAndrew).
+	*/
+	Vector_Point_2D Hull() const;
+
+	/*
+	* The upper and lower hulls of the set, from the smallest to the largest point in lexicographic order.
+	*/
+	Vector_Point_2D UpperHull() const;
+	Vector_Point_2D LowerHull() const;
+
+	/*
+	* Height of the tree (0 for at most one distinct point).
+	*/
+	int Height() const;
+
+private:
+	enum Side
+	{
+		UPPER = 0,
+		LOWER = 1
+	};
+
+	// Leaves hold a point and its count; internal nodes have two children and the bridges of each side. maxLeaf is the
+	// largest leaf of the subtree, the routing key of the parent.
+	struct Node
+	{
+		int left;
+		int right;
+		int parent;
+		int height;
+		int maxLeaf;
+		int bridgeLeft[2];
+		int bridgeRight[2];
+		Point_2D point;
+		size_t count;
+	};
+
+	bool IsLeaf(int v) const;
+	bool Less(int leafA, int leafB) const;
+	CGAL::Orientation Orientation(const Point_2D& p, const Point_2D& q, const Point_2D& r, Side side) const;
+	int Tangent(int v, const Point_2D& q, Side side) const;
+	void Bridge(int v, Side side);
+	void Update(int v);
+	int Rotate(int v, bool toLeft);
+	void Rebalance(int v);
+	void Replace(int v, int w);
+	int NewNode();
+	void Chain(int v, int lo, int hi, Side side, Vector_Point_2D& chain) const;
+
+	std::vector<Node> nodes;
+	std::vector<int> freeNodes;
+	int root;
+	size_t nrOfPoints;
+};
+
+/*
+* This function is responsible for cross checking Dynamic_Convex_Hull against GrahamAndrew on a seeded random sequence
+* of the given number of insertions and deletions of points with small integer coordinates (so that equal and collinear
+* points are frequent). The hulls are compared after every operation. Returns false, and displays the first mismatch,
+* if they ever differ.
+*/
+bool CrossCheckDynamicConvexHull(int nrOfOperations, unsigned int seed);
+#endif
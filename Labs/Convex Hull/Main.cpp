@@ -1,40 +1,62 @@
-//General C++ Standard Libraries
-#include <iostream>
-
-// Linker to Header File
-#include "ConvexHull.h"
-
-// * Vectors are sequence containers representing arrays that can change in size.
-// * https://www.cplusplus.com/reference/vector/vector/
-#include <vector>
-
-// Predefined Kernel:
-// * Exact Geometric Predicates Inexact Geometric Constructions 
-// * It uses Cartesian representation.
-// * It supports constructions of points from double Cartesian coordinates.
-// * It provides exact geometric predicates, but inexact geometric constructions.
-// * https://doc.cgal.org/5.0.4/Kernel_23/classCGAL_1_1Exact__predicates__inexact__constructions__kernel.html
-#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
-
-// Naming Conventions for simplicity
-// * Kernel : CGAL::Exact_predicates_inexact_constructions_kernel
-typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
-
-// * Point_2D : CGAL::Exact_predicates_inexact_constructions_kernel
-typedef Kernel::Point_2 Point_2D;
-
-// * Vector_2D : std::vector<Point_2D>
-typedef std::vector<Point_2D> Vector_2D;
-
-int main()
-{
-	Vector_2D generatedRandomPoints = Generate2DInstance(1,30, 8);
-	std::cout << "Generated points:" << std::endl;
-	DisplayVector(generatedRandomPoints, 3);
-	std::cout << "-------------------------------" << std::endl;
-	Vector_2D convexPolygon = GrahamAndrew(generatedRandomPoints);
-	std::cout << "Convex Polygon:" << std::endl;
-	DisplayVector(convexPolygon, 3);
-	std::cout << "-------------------------------" << std::endl;
-	return 0;
-}
\ No newline at end of file
+// Linker to Header File
+#include "ConvexHull.h"
+#include "DynamicConvexHull.h"
+
+int main()
+{
+	Vector_Point_2D generatedRandomPoints = GeneratePoints2DInstance(1,30, 8);
+	std::cout << "Generated points:" << std::endl;
+	DisplayPoints(generatedRandomPoints, 3);
+	std::cout << "-------------------------------" << std::endl;
+	Vector_Point_2D convexPolygon = GrahamAndrew(generatedRandomPoints);
+	std::cout << "Convex Polygon:" << std::endl;
+	DisplayPoints(convexPolygon, 3);
+	std::cout << "-------------------------------" << std::endl;
+
+	// Same points, inserted one by one into the dynamic hull; then half of them are removed again.
+	Dynamic_Convex_Hull dynamicHull;
+	for (int i = 0; i < generatedRandomPoints.size(); i++)
+	{
+		dynamicHull.Insert(generatedRandomPoints[i]);
+	}
+	std::cout << "Dynamic Convex Polygon:" << std::endl;
+	DisplayPoints(dynamicHull.Hull(), 3);
+	for (int i = 0; i < generatedRandomPoints.size() / 2; i++)
+	{
+		dynamicHull.Remove(generatedRandomPoints[i]);
+	}
+	std::cout << "Dynamic Convex Polygon after removing the first " << generatedRandomPoints.size() / 2 << " points:" << std::endl;
+	DisplayPoints(dynamicHull.Hull(), 3);
+	std::cout << "-------------------------------" << std::endl;
+
+	// 1000 groups of 8 points in one flat vector, hulled in one batch and checked against GrahamAndrew group by group.
+	Vector_Point_2D groupedPoints = GeneratePoints2DInstance(1, 30, 8000, 1);
+	std::vector<size_t> offsets;
+	for (size_t offset = 0; offset <= groupedPoints.size(); offset += 8)
+	{
+		offsets.push_back(offset);
+	}
+	Vector_Point_2D hulls;
+	std::vector<size_t> hullOffsets;
+	if (!BatchGrahamAndrew(groupedPoints, offsets, hulls, hullOffsets))
+	{
+		return 1;
+	}
+	for (size_t g = 0; g + 1 < offsets.size(); g++)
+	{
+		Vector_Point_2D group(groupedPoints.begin() + offsets[g], groupedPoints.begin() + offsets[g + 1]);
+		if (Vector_Point_2D(hulls.begin() + hullOffsets[g], hulls.begin() + hullOffsets[g + 1]) != GrahamAndrew(group))
+		{
+			std::cout << "Batch convex hull mismatch in group " << g << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "Batch convex hulls of " << offsets.size() - 1 << " groups match Graham - Andrew (" << hulls.size() << " hull points)." << std::endl;
+
+	if (!CrossCheckDynamicConvexHull(20000, 1))
+	{
+		return 1;
+	}
+	std::cout << "Dynamic convex hull matches Graham - Andrew on 20000 random insertions and deletions." << std::endl;
+	return 0;
+}
@@ -0,0 +1,502 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Bentley - Ottmann sweep over line segments on flat containers: the event queue is a binary heap stored in a vector and
+// the status line a sequence of small sorted arrays, instead of the node based containers of the CGAL surface sweep.
+// It replaces the sweep of CGAL::compute_intersection_points only. The sweep of the arrangement construction
+// (CGAL::insert) is left to CGAL: it builds the DCEL through its own visitor, which this engine, reporting points only,
+// does not provide.
+// https://doi.org/10.1109/TC.1979.1675432
+
+#ifndef FLAT_SWEEP_H
+#define FLAT_SWEEP_H
+
+// * Vectors are sequence containers representing arrays that can change in size.
+// * https://www.cplusplus.com/reference/vector/vector/
+#include <vector>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// CGAL predicate results (Orientation, Comparison_result, Sign)
+#include <CGAL/enum.h>
+
+/*
+* Event queue of the sweep: a binary min - heap of (point, segment) events, stored in a single vector and ordered
+* lexicographically by point with the given Compare_xy_2 functor. Events at equal points come out consecutively.
+*/
+template <class Point, class Compare_xy>
+class Sweep_Event_Queue
+{
+public:
+	struct Event
+	{
+		Point point;
+		size_t segment;
+	};
+
+	Sweep_Event_Queue(Compare_xy compareXY) : compareXY(compareXY)
+	{
+	}
+
+	void Reserve(size_t nrOfEvents)
+	{
+		heap.reserve(nrOfEvents);
+	}
+
+	void Push(const Point& point, size_t segment)
+	{
+		Event event = { point, segment };
+		heap.push_back(event);
+		std::push_heap(heap.begin(), heap.end(), Later(compareXY));
+	}
+
+	bool Empty() const
+	{
+		return heap.empty();
+	}
+
+	const Event& Top() const
+	{
+		return heap.front();
+	}
+
+	void Pop()
+	{
+		std::pop_heap(heap.begin(), heap.end(), Later(compareXY));
+		heap.pop_back();
+	}
+
+private:
+	struct Later
+	{
+		Compare_xy compareXY;
+
+		Later(Compare_xy compareXY) : compareXY(compareXY)
+		{
+		}
+
+		bool operator()(const Event& a, const Event& b) const
+		{
+			return compareXY(a.point, b.point) == CGAL::LARGER;
+		}
+	};
+
+	Compare_xy compareXY;
+	std::vector<Event> heap;
+};
+
+/*
+* Status line of the sweep: segment indices from bottom to top, kept in a sequence of sorted blocks of up to
+* 2 * Block_Size indices (a B - tree of height two). A search is a binary search over the last index of every block, then
+* over one block; inserting or erasing moves at most one block and, when a block splits or merges, the block headers.
+* A Position is a (block, offset) pair; End() is one past the last index.
+*/
+class Sweep_Status
+{
+public:
+	static const size_t Block_Size = 64;
+
+	struct Position
+	{
+		size_t block;
+		size_t offset;
+	};
+
+	Position End() const
+	{
+		Position end = { blocks.size(), 0 };
+		return end;
+	}
+
+	bool IsEnd(const Position& position) const
+	{
+		return position.block == blocks.size();
+	}
+
+	size_t At(const Position& position) const
+	{
+		return blocks[position.block][position.offset];
+	}
+
+	Position Next(const Position& position) const
+	{
+		Position next = position;
+		if (++next.offset == blocks[next.block].size())
+		{
+			next.block++;
+			next.offset = 0;
+		}
+		return next;
+	}
+
+	/*
+	* Writes the position before the given one to previous; returns false at the first position.
+	*/
+	bool Previous(const Position& position, Position& previous) const
+	{
+		if (position.offset > 0)
+		{
+			previous.block = position.block;
+			previous.offset = position.offset - 1;
+			return true;
+		}
+		if (position.block == 0)
+		{
+			return false;
+		}
+		previous.block = position.block - 1;
+		previous.offset = blocks[previous.block].size() - 1;
+		return true;
+	}
+
+	/*
+	* The first position whose segment is not below(segment); below must be true for a prefix of the status only.
+	*/
+	template <class Below>
+	Position PartitionPoint(Below below) const
+	{
+		size_t low = 0;
+		size_t high = blocks.size();
+		while (low < high)
+		{
+			size_t middle = low + (high - low) / 2;
+			if (below(blocks[middle].back()))
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+		Position position = { low, 0 };
+		if (low < blocks.size())
+		{
+			position.offset = std::partition_point(blocks[low].begin(), blocks[low].end(), below) - blocks[low].begin();
+		}
+		return position;
+	}
+
+	/*
+	* Erases count consecutive indices from the given position on, and returns the position of the index that followed
+	* them.
+	*/
+	Position Erase(Position position, size_t count)
+	{
+		while (count > 0)
+		{
+			std::vector<size_t>& block = blocks[position.block];
+			size_t erased = std::min(count, block.size() - position.offset);
+			block.erase(block.begin() + position.offset, block.begin() + position.offset + erased);
+			count -= erased;
+			if (block.empty())
+			{
+				blocks.erase(blocks.begin() + position.block);
+			}
+			else if (position.offset == block.size())
+			{
+				position.block++;
+				position.offset = 0;
+			}
+		}
+
+		// A small block absorbs the next one, so the number of blocks stays proportional to size / Block_Size.
+		size_t block = std::min(position.block, blocks.size() - (blocks.empty() ? 0 : 1));
+		if (block + 1 < blocks.size() && blocks[block].size() < Block_Size / 2 && blocks[block].size() + blocks[block + 1].size() <= 2 * Block_Size)
+		{
+			if (position.block == block + 1)
+			{
+				position.block = block;
+				position.offset += blocks[block].size();
+			}
+			blocks[block].insert(blocks[block].end(), blocks[block + 1].begin(), blocks[block + 1].end());
+			blocks.erase(blocks.begin() + block + 1);
+		}
+		return position;
+	}
+
+	/*
+	* Inserts the given indices, in order, before the given position, and returns the position of the first of them.
+	*/
+	Position Insert(Position position, const std::vector<size_t>& run)
+	{
+		if (run.empty())
+		{
+			return position;
+		}
+		if (blocks.empty())
+		{
+			blocks.push_back(std::vector<size_t>());
+		}
+		if (IsEnd(position))
+		{
+			position.block = blocks.size() - 1;
+			position.offset = blocks.back().size();
+		}
+		std::vector<size_t>& block = blocks[position.block];
+		block.insert(block.begin() + position.offset, run.begin(), run.end());
+		if (block.size() <= 2 * Block_Size)
+		{
+			return position;
+		}
+
+		// Split the full block into blocks of Block_Size indices.
+		std::vector<size_t> full;
+		full.swap(blocks[position.block]);
+		size_t nrOfBlocks = (full.size() + Block_Size - 1) / Block_Size;
+		std::vector<std::vector<size_t>> split(nrOfBlocks);
+		for (size_t b = 0; b < nrOfBlocks; b++)
+		{
+			split[b].assign(full.begin() + b * Block_Size, full.begin() + std::min(full.size(), (b + 1) * Block_Size));
+		}
+		blocks.erase(blocks.begin() + position.block);
+		blocks.insert(blocks.begin() + position.block, split.begin(), split.end());
+		position.block += position.offset / Block_Size;
+		position.offset %= Block_Size;
+		return position;
+	}
+
+	size_t Size() const
+	{
+		size_t size = 0;
+		for (size_t b = 0; b < blocks.size(); b++)
+		{
+			size += blocks[b].size();
+		}
+		return size;
+	}
+
+private:
+	std::vector<std::vector<size_t>> blocks;
+};
+
+/*
+* Intersection points of a fixed vector of line segments of the kernel K, computed with the Bentley - Ottmann sweep over
+* the flat containers above. The points are those of CGAL::compute_intersection_points, in the same (lexicographic)
+* order: every point where two segments cross or where an end point touches the interior of another segment, and both
+* ends of every collinear overlap. Points shared only as end points are not reported; degenerate segments are ignored.
+* Crossing points are constructed (as lazy exact points with EPECK) only for pairs that cross properly.
+*/
+template <class K>
+class Flat_Segment_Sweep
+{
+public:
+	typedef typename K::Point_2 Point;
+	typedef typename K::Segment_2 Segment;
+
+	Flat_Segment_Sweep(const std::vector<Segment>& segments) : segments(segments), events(0), maxStatusSize(0)
+	{
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		left.reserve(segments.size());
+		right.reserve(segments.size());
+		for (size_t i = 0; i < segments.size(); i++)
+		{
+			CGAL::Comparison_result order = compareXY(segments[i].source(), segments[i].target());
+			left.push_back(order == CGAL::LARGER ? segments[i].target() : segments[i].source());
+			right.push_back(order == CGAL::LARGER ? segments[i].source() : segments[i].target());
+			degenerate.push_back(order == CGAL::EQUAL);
+		}
+	}
+
+	/*
+	* Calls output(point) for every intersection point, in lexicographic order.
+	*/
+	template <class Output>
+	void Points(Output output)
+	{
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		Sweep_Event_Queue<Point, typename K::Compare_xy_2> queue(compareXY);
+		queue.Reserve(2 * left.size());
+		for (size_t i = 0; i < left.size(); i++)
+		{
+			if (!degenerate[i])
+			{
+				queue.Push(left[i], i);
+				queue.Push(right[i], No_Segment);
+			}
+		}
+
+		Sweep_Status status;
+		std::vector<size_t> starting;
+		std::vector<size_t> ending;
+		std::vector<size_t> run;
+		events = 0;
+		maxStatusSize = 0;
+		size_t statusSize = 0;
+		while (!queue.Empty())
+		{
+			// Every event at the point: the segments starting there come with their own event; the others (ending at
+			// the point or passing through it) are found in the status.
+			Point point = queue.Top().point;
+			starting.clear();
+			while (!queue.Empty() && compareXY(queue.Top().point, point) == CGAL::EQUAL)
+			{
+				if (queue.Top().segment != No_Segment)
+				{
+					starting.push_back(queue.Top().segment);
+				}
+				queue.Pop();
+			}
+			events++;
+
+			// The segments through the point are consecutive in the status, after the ones below it.
+			typename Sweep_Status::Position first = status.PartitionPoint([this, &point](size_t segment)
+			{
+				return Side(segment, point) == CGAL::POSITIVE;
+			});
+			ending.clear();
+			run.clear();
+			size_t nrOfThrough = 0;
+			for (typename Sweep_Status::Position position = first; !status.IsEnd(position) && Side(status.At(position), point) == CGAL::ZERO; position = status.Next(position))
+			{
+				size_t segment = status.At(position);
+				(compareXY(right[segment], point) == CGAL::EQUAL ? ending : run).push_back(segment);
+				nrOfThrough++;
+			}
+
+			// The point is reported when it lies inside a segment and on another one, or when two segments leave it (or
+			// reach it) in the same direction, i.e. overlap from it.
+			std::sort(starting.begin(), starting.end(), DirectionLess(this, &point, true));
+			std::sort(ending.begin(), ending.end(), DirectionLess(this, &point, false));
+			if ((!run.empty() && run.size() + ending.size() + starting.size() >= 2) || SameDirection(starting, point, true) || SameDirection(ending, point, false))
+			{
+				output(point);
+			}
+
+			// The segments passing through the point continue with the starting ones, in their order just after it.
+			typename Sweep_Status::Position at = status.Erase(first, nrOfThrough);
+			statusSize -= nrOfThrough;
+			run.insert(run.end(), starting.begin(), starting.end());
+			std::sort(run.begin(), run.end(), DirectionLess(this, &point, true));
+			typename Sweep_Status::Position previous;
+			if (run.empty())
+			{
+				if (!status.IsEnd(at) && status.Previous(at, previous))
+				{
+					FindEvent(status.At(previous), status.At(at), point, queue);
+				}
+				continue;
+			}
+
+			at = status.Insert(at, run);
+			statusSize += run.size();
+			maxStatusSize = std::max(maxStatusSize, statusSize);
+			if (status.Previous(at, previous))
+			{
+				FindEvent(status.At(previous), run.front(), point, queue);
+			}
+			typename Sweep_Status::Position after = at;
+			for (size_t k = 0; k < run.size(); k++)
+			{
+				after = status.Next(after);
+			}
+			if (!status.IsEnd(after))
+			{
+				FindEvent(run.back(), status.At(after), point, queue);
+			}
+		}
+	}
+
+	/*
+	* Number of distinct event points of the last sweep, and the largest number of segments in the status.
+	*/
+	size_t Events() const
+	{
+		return events;
+	}
+
+	size_t MaxStatusSize() const
+	{
+		return maxStatusSize;
+	}
+
+private:
+	static const size_t No_Segment = (size_t)-1;
+
+	// Position of the point relative to a segment of the status, which spans its x - coordinate: POSITIVE above,
+	// NEGATIVE below, ZERO on the segment.
+	CGAL::Sign Side(size_t segment, const Point& point) const
+	{
+		return CGAL::Sign(kernel.orientation_2_object()(left[segment], right[segment], point));
+	}
+
+	// Angular order around the point of segments leaving it to the right (outgoing) or reaching it from the left: all
+	// their other end points lie in the same half - plane, so the orientation is a strict weak order. Collinear segments
+	// are ordered by index.
+	struct DirectionLess
+	{
+		const Flat_Segment_Sweep* sweep;
+		const Point* point;
+		bool outgoing;
+
+		DirectionLess(const Flat_Segment_Sweep* sweep, const Point* point, bool outgoing) : sweep(sweep), point(point), outgoing(outgoing)
+		{
+		}
+
+		bool operator()(size_t a, size_t b) const
+		{
+			const Point& endA = outgoing ? sweep->right[a] : sweep->left[a];
+			const Point& endB = outgoing ? sweep->right[b] : sweep->left[b];
+			CGAL::Orientation turn = sweep->kernel.orientation_2_object()(*point, endA, endB);
+			return turn == CGAL::COLLINEAR ? a < b : turn == CGAL::LEFT_TURN;
+		}
+	};
+
+	// The segments are sorted by DirectionLess: overlapping ones are adjacent.
+	bool SameDirection(const std::vector<size_t>& sorted, const Point& point, bool outgoing) const
+	{
+		for (size_t k = 0; k + 1 < sorted.size(); k++)
+		{
+			const Point& endA = outgoing ? right[sorted[k]] : left[sorted[k]];
+			const Point& endB = outgoing ? right[sorted[k + 1]] : left[sorted[k + 1]];
+			if (kernel.orientation_2_object()(point, endA, endB) == CGAL::COLLINEAR)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Adds the crossing of the neighbours a (below) and b (above) if it lies after the point. Only proper crossings are
+	// constructed: a touching point is an end point, an overlap starts and ends at end points, and those are events
+	// already.
+	void FindEvent(size_t a, size_t b, const Point& point, Sweep_Event_Queue<Point, typename K::Compare_xy_2>& queue) const
+	{
+		typename K::Orientation_2 orientation = kernel.orientation_2_object();
+		CGAL::Orientation o1 = orientation(left[a], right[a], left[b]);
+		CGAL::Orientation o2 = orientation(left[a], right[a], right[b]);
+		if (o1 == CGAL::COLLINEAR || o2 == CGAL::COLLINEAR || o1 == o2)
+		{
+			return;
+		}
+		CGAL::Orientation o3 = orientation(left[b], right[b], left[a]);
+		CGAL::Orientation o4 = orientation(left[b], right[b], right[a]);
+		if (o3 == CGAL::COLLINEAR || o4 == CGAL::COLLINEAR || o3 == o4)
+		{
+			return;
+		}
+		// CGAL::intersection
+		// Constructs the intersection of two segments; for a proper crossing it is a point.
+		// https://doc.cgal.org/5.0.4/Kernel_23/group__intersection__linear__grp.html
+		auto intersection = CGAL::intersection(segments[a], segments[b]);
+		if (intersection)
+		{
+			const Point* crossing = boost::get<Point>(&*intersection);
+			if (crossing != nullptr && kernel.compare_xy_2_object()(*crossing, point) == CGAL::LARGER)
+			{
+				queue.Push(*crossing, No_Segment);
+			}
+		}
+	}
+
+	K kernel;
+	std::vector<Segment> segments;
+	std::vector<Point> left;
+	std::vector<Point> right;
+	std::vector<char> degenerate;
+	size_t events;
+	size_t maxStatusSize;
+};
+#endif
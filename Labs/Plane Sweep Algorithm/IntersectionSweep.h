@@ -0,0 +1,771 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Shamos - Hoey sweep (any intersection, O(nlogn)) and Bentley - Ottmann sweep (all intersecting pairs, O((n + k)logn))
+// over line segments, evaluated with the predicates of a CGAL kernel only: no intersection point is ever constructed.
+// https://doi.org/10.1109/SFCS.1976.16
+// https://doi.org/10.1109/TC.1979.1675432
+
+#ifndef INTERSECTION_SWEEP_H
+#define INTERSECTION_SWEEP_H
+
+// * Vectors are sequence containers representing arrays that can change in size.
+// * https://www.cplusplus.com/reference/vector/vector/
+#include <vector>
+
+// * Sets are containers that store unique elements following a specific order.
+// * https://www.cplusplus.com/reference/set/set/
+#include <set>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that defines elements with the characteristics of arithmetic types (std::numeric_limits).
+// * https://www.cplusplus.com/reference/limits/
+#include <limits>
+
+// CGAL predicate results (Orientation, Comparison_result)
+#include <CGAL/enum.h>
+
+// * Segment_Index_Pair : std::pair<size_t, size_t>
+typedef std::pair<size_t, size_t> Segment_Index_Pair;
+
+// * Vector_Segment_Index_Pair : std::vector<Segment_Index_Pair>
+typedef std::vector<Segment_Index_Pair> Vector_Segment_Index_Pair;
+
+/*
+* Intersection queries over a fixed vector of line segments of the kernel K. Two segments intersect when they have a
+* common point that is not a common end point of both: crossings, touchings of an end point with the interior of the other
+* segment, and collinear overlaps. This is exactly the set of points reported by CGAL::compute_intersection_points, so a
+* valid planar subdivision, whose edges only meet at shared vertices, has no intersecting pair.
+* Degenerate segments (source == target) are ignored.
+*/
+template <class K>
+class Segment_Intersection_Sweep
+{
+public:
+	typedef typename K::Point_2 Point;
+	typedef typename K::Segment_2 Segment;
+	typedef typename K::Line_2 Line;
+
+	Segment_Intersection_Sweep(const std::vector<Segment>& segments)
+	{
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		left.reserve(segments.size());
+		right.reserve(segments.size());
+		for (size_t i = 0; i < segments.size(); i++)
+		{
+			// Every segment is stored from its lexicographically smaller end point (left) to the larger (right).
+			CGAL::Comparison_result order = compareXY(segments[i].source(), segments[i].target());
+			left.push_back(order == CGAL::LARGER ? segments[i].target() : segments[i].source());
+			right.push_back(order == CGAL::LARGER ? segments[i].source() : segments[i].target());
+			degenerate.push_back(order == CGAL::EQUAL);
+		}
+	}
+
+	/*
+	* Returns true if the segments i and j intersect (see above).
+	*/
+	bool Intersect(size_t i, size_t j) const
+	{
+		if (degenerate[i] || degenerate[j])
+		{
+			return false;
+		}
+		typename K::Orientation_2 orientation = kernel.orientation_2_object();
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		const Point& a0 = left[i];
+		const Point& a1 = right[i];
+		const Point& b0 = left[j];
+		const Point& b1 = right[j];
+		CGAL::Orientation o1 = orientation(a0, a1, b0);
+		CGAL::Orientation o2 = orientation(a0, a1, b1);
+		if (o1 != CGAL::COLLINEAR && o1 == o2)
+		{
+			return false;
+		}
+		if (o1 == CGAL::COLLINEAR && o2 == CGAL::COLLINEAR)
+		{
+			// Same supporting line: the end points are ordered along it, the overlap must have a positive length.
+			return compareXY(a0, b1) == CGAL::SMALLER && compareXY(b0, a1) == CGAL::SMALLER;
+		}
+		CGAL::Orientation o3 = orientation(b0, b1, a0);
+		CGAL::Orientation o4 = orientation(b0, b1, a1);
+		if (o3 != CGAL::COLLINEAR && o3 == o4)
+		{
+			return false;
+		}
+		// Distinct supporting lines meeting on both segments: a single common point, which is allowed only when it is
+		// a common end point.
+		typename K::Equal_2 equal = kernel.equal_2_object();
+		return !(equal(a0, b0) || equal(a0, b1) || equal(a1, b0) || equal(a1, b1));
+	}
+
+	/*
+	* Returns true if any two segments intersect, stopping at the first event where an intersection is detected
+	* (Shamos - Hoey sweep, O(nlogn) time). The indices of an intersecting pair are written to witness, if given.
+	*/
+	bool Any(Segment_Index_Pair* witness = nullptr) const
+	{
+		std::vector<size_t> events;
+		for (size_t i = 0; i < left.size(); i++)
+		{
+			if (!degenerate[i])
+			{
+				events.push_back(2 * i);
+				events.push_back(2 * i + 1);
+			}
+		}
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		std::sort(events.begin(), events.end(), [this, &compareXY](size_t a, size_t b)
+		{
+			return compareXY(EventPoint(a), EventPoint(b)) == CGAL::SMALLER;
+		});
+
+		Sweep_State state(*this);
+		Status_Less less(&state);
+		Status status(less);
+		std::vector<typename Status::iterator> position(left.size(), status.end());
+		std::vector<size_t> starting;
+
+		size_t first = 0;
+		while (first < events.size())
+		{
+			state.point = &EventPoint(events[first]);
+			size_t last = first;
+			while (last < events.size() && compareXY(EventPoint(events[last]), *state.point) == CGAL::EQUAL)
+			{
+				last++;
+			}
+
+			// Remove the segments that end at the event point.
+			starting.clear();
+			for (size_t e = first; e < last; e++)
+			{
+				size_t segment = events[e] / 2;
+				if (events[e] % 2 == 1)
+				{
+					status.erase(position[segment]);
+					position[segment] = status.end();
+				}
+				else
+				{
+					starting.push_back(segment);
+				}
+			}
+
+			// No segment left in the status may pass through the event point: it would be touched by the segment that
+			// starts or ends there.
+			typename Status::iterator above = status.lower_bound(Sweep_Probe());
+			if (above != status.end() && state.Side(*above) == CGAL::ZERO)
+			{
+				return Report(*above, events[first] / 2, witness);
+			}
+
+			if (starting.empty())
+			{
+				if (above != status.end() && above != status.begin() && Check(*std::prev(above), *above, witness))
+				{
+					return true;
+				}
+				first = last;
+				continue;
+			}
+
+			// Segments starting at the same point overlap exactly when they leave it in the same direction.
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				state.starting[starting[k]] = true;
+			}
+			std::sort(starting.begin(), starting.end(), less);
+			for (size_t k = 0; k + 1 < starting.size(); k++)
+			{
+				if (state.SameDirection(starting[k], starting[k + 1]))
+				{
+					return Report(starting[k], starting[k + 1], witness);
+				}
+			}
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				position[starting[k]] = status.insert(above, starting[k]);
+			}
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				state.starting[starting[k]] = false;
+			}
+
+			typename Status::iterator lowest = position[starting.front()];
+			typename Status::iterator highest = position[starting.back()];
+			if (lowest != status.begin() && Check(*std::prev(lowest), *lowest, witness))
+			{
+				return true;
+			}
+			if (std::next(highest) != status.end() && Check(*highest, *std::next(highest), witness))
+			{
+				return true;
+			}
+			first = last;
+		}
+		return false;
+	}
+
+	/*
+	* Calls output(i, j), with i < j, for every intersecting pair of segments (in no particular order), with a
+	* Bentley - Ottmann sweep in O((n + k)logn) time for k intersecting pairs. A crossing event is kept as the pair of
+	* segments that cross there, and events are ordered with the kernel predicates on their supporting lines
+	* (Compare_x_2 and Compare_y_2 of line intersections), so the crossing points are never constructed. The segments
+	* through an event are reported and reordered as a bundle, which covers several segments through one point, touchings
+	* and collinear overlaps; overlapping segments are compared again at every event inside their overlap. Vertical
+	* segments are not in the status: the segments they meet are collected from it at their two end points.
+	*/
+	template <class Output>
+	void Pairs(Output output) const
+	{
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		Pairs_State state(*this);
+
+		std::vector<size_t> events;
+		std::vector<size_t> verticals;
+		for (size_t i = 0; i < left.size(); i++)
+		{
+			if (!degenerate[i])
+			{
+				events.push_back(2 * i);
+				events.push_back(2 * i + 1);
+				if (state.vertical[i])
+				{
+					verticals.push_back(i);
+				}
+			}
+		}
+		std::sort(events.begin(), events.end(), [this, &compareXY](size_t a, size_t b)
+		{
+			return compareXY(EventPoint(a), EventPoint(b)) == CGAL::SMALLER;
+		});
+		ReportVerticalOverlaps(verticals, output);
+
+		Pairs_Less less(&state);
+		Pairs_Status status(less);
+		Crossing_Less crossingLess(&state);
+		std::set<Sweep_Point, Crossing_Less> crossings(crossingLess);
+		std::vector<size_t> starting;
+		std::vector<size_t> through;
+		std::vector<size_t> ending;
+		std::vector<size_t> tops;
+
+		size_t first = 0;
+		while (first < events.size() || !crossings.empty())
+		{
+			// The next event is the smaller of the next end point and the first crossing; an end point that is also a
+			// crossing point stands for both.
+			size_t last = first;
+			if (first < events.size() && (crossings.empty() || state.Compare(Sweep_Point(events[first]), *crossings.begin()) != CGAL::LARGER))
+			{
+				state.point = Sweep_Point(events[first]);
+				while (last < events.size() && compareXY(EventPoint(events[last]), EventPoint(events[first])) == CGAL::EQUAL)
+				{
+					last++;
+				}
+				if (!crossings.empty() && state.Compare(state.point, *crossings.begin()) == CGAL::EQUAL)
+				{
+					crossings.erase(crossings.begin());
+				}
+			}
+			else
+			{
+				state.point = *crossings.begin();
+				crossings.erase(crossings.begin());
+			}
+
+			starting.clear();
+			tops.clear();
+			for (size_t e = first; e < last; e++)
+			{
+				size_t segment = events[e] / 2;
+				if (!state.vertical[segment])
+				{
+					if (events[e] % 2 == 0)
+					{
+						starting.push_back(segment);
+					}
+				}
+				else if (events[e] % 2 == 0)
+				{
+					// Segments crossing the vertical segment, or ending on it, before the status changes at its bottom.
+					ReportVertical(state, status, segment, false, output);
+				}
+				else
+				{
+					tops.push_back(segment);
+				}
+			}
+
+			// The status segments through the event point are contiguous: split them into the ones that end there and
+			// the ones that go on.
+			typename Pairs_Status::iterator lowest = status.lower_bound(Pairs_Probe(state.point));
+			typename Pairs_Status::iterator above = status.upper_bound(Pairs_Probe(state.point));
+			through.clear();
+			ending.clear();
+			for (typename Pairs_Status::iterator it = lowest; it != above; ++it)
+			{
+				if (state.Compare(Sweep_Point(2 * *it + 1), state.point) == CGAL::EQUAL)
+				{
+					ending.push_back(*it);
+				}
+				else
+				{
+					through.push_back(*it);
+				}
+			}
+
+			// A pair through the event point is reported here unless it met before: collinear segments that both go
+			// on, or where one ends, overlap since the later start, and segments that both end (or one ends and the
+			// other starts) only share an end point.
+			for (size_t a = 0; a < through.size(); a++)
+			{
+				for (size_t b = a + 1; b < through.size(); b++)
+				{
+					if (!state.Collinear(through[a], through[b]))
+					{
+						output(std::min(through[a], through[b]), std::max(through[a], through[b]));
+					}
+				}
+				for (size_t b = 0; b < ending.size(); b++)
+				{
+					if (!state.Collinear(through[a], ending[b]))
+					{
+						output(std::min(through[a], ending[b]), std::max(through[a], ending[b]));
+					}
+				}
+				for (size_t b = 0; b < starting.size(); b++)
+				{
+					output(std::min(through[a], starting[b]), std::max(through[a], starting[b]));
+				}
+			}
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				state.bundle[starting[k]] = true;
+			}
+			std::sort(starting.begin(), starting.end(), less);
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				for (size_t m = k + 1; m < starting.size() && state.Collinear(starting[k], starting[m]); m++)
+				{
+					output(std::min(starting[k], starting[m]), std::max(starting[k], starting[m]));
+				}
+			}
+
+			// The segments that go on are reinserted with the starting ones, in their order just after the event point.
+			status.erase(lowest, above);
+			for (size_t k = 0; k < through.size(); k++)
+			{
+				state.bundle[through[k]] = true;
+				starting.push_back(through[k]);
+			}
+			std::sort(starting.begin(), starting.end(), less);
+			typename Pairs_Status::iterator bottom = above;
+			typename Pairs_Status::iterator top = above;
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				top = status.insert(above, starting[k]);
+				if (k == 0)
+				{
+					bottom = top;
+				}
+			}
+			for (size_t k = 0; k < starting.size(); k++)
+			{
+				state.bundle[starting[k]] = false;
+			}
+
+			if (starting.empty())
+			{
+				if (above != status.begin() && above != status.end())
+				{
+					ScheduleCrossing(state, crossings, *std::prev(above), *above);
+				}
+			}
+			else
+			{
+				if (bottom != status.begin())
+				{
+					ScheduleCrossing(state, crossings, *std::prev(bottom), *bottom);
+				}
+				if (std::next(top) != status.end())
+				{
+					ScheduleCrossing(state, crossings, *top, *std::next(top));
+				}
+			}
+
+			// Segments starting on a vertical segment, once they are in the status.
+			for (size_t k = 0; k < tops.size(); k++)
+			{
+				ReportVertical(state, status, tops[k], true, output);
+			}
+			first = last;
+		}
+	}
+
+private:
+	// Compared against the segments of the status, the probe stands for the current event point.
+	struct Sweep_Probe
+	{
+	};
+
+	struct Sweep_State
+	{
+		const Segment_Intersection_Sweep& sweep;
+		const Point* point;
+		std::vector<char> starting;
+
+		Sweep_State(const Segment_Intersection_Sweep& sweep) : sweep(sweep), point(nullptr), starting(sweep.left.size(), false)
+		{
+		}
+
+		// Position of the event point relative to a segment of the status, which spans its x - coordinate:
+		// POSITIVE above, NEGATIVE below, ZERO on the segment.
+		CGAL::Sign Side(size_t segment) const
+		{
+			return CGAL::Sign(sweep.kernel.orientation_2_object()(sweep.left[segment], sweep.right[segment], *point));
+		}
+
+		bool IsVertical(size_t segment) const
+		{
+			return sweep.kernel.compare_x_2_object()(sweep.left[segment], sweep.right[segment]) == CGAL::EQUAL;
+		}
+
+		// Both segments start at the event point.
+		bool SameDirection(size_t a, size_t b) const
+		{
+			if (IsVertical(a) || IsVertical(b))
+			{
+				return IsVertical(a) && IsVertical(b);
+			}
+			return sweep.kernel.orientation_2_object()(*point, sweep.right[a], sweep.right[b]) == CGAL::COLLINEAR;
+		}
+
+		// Order, just to the right of the event point, of two segments that start there. Vertical segments go last.
+		bool StartingLess(size_t a, size_t b) const
+		{
+			bool verticalA = IsVertical(a);
+			bool verticalB = IsVertical(b);
+			if (verticalA || verticalB)
+			{
+				return verticalA == verticalB ? a < b : verticalB;
+			}
+			CGAL::Orientation turn = sweep.kernel.orientation_2_object()(*point, sweep.right[a], sweep.right[b]);
+			return turn == CGAL::COLLINEAR ? a < b : turn == CGAL::LEFT_TURN;
+		}
+	};
+
+	// Orders the segments of the status from bottom to top along the sweep line. Only segments starting at the event
+	// point are ever compared with the others; the status is then known not to pass through the event point.
+	struct Status_Less
+	{
+		typedef void is_transparent;
+
+		const Sweep_State* state;
+
+		Status_Less(const Sweep_State* state) : state(state)
+		{
+		}
+
+		bool operator()(size_t a, size_t b) const
+		{
+			if (a == b)
+			{
+				return false;
+			}
+			bool startsA = state->starting[a];
+			bool startsB = state->starting[b];
+			if (startsA && startsB)
+			{
+				return state->StartingLess(a, b);
+			}
+			if (startsA)
+			{
+				return state->Side(b) == CGAL::NEGATIVE;
+			}
+			if (startsB)
+			{
+				return state->Side(a) == CGAL::POSITIVE;
+			}
+			return a < b;
+		}
+
+		bool operator()(size_t segment, Sweep_Probe) const
+		{
+			return state->Side(segment) == CGAL::POSITIVE;
+		}
+
+		bool operator()(Sweep_Probe, size_t segment) const
+		{
+			return state->Side(segment) == CGAL::NEGATIVE;
+		}
+	};
+
+	typedef std::set<size_t, Status_Less> Status;
+
+	static const size_t No_Segment = std::numeric_limits<size_t>::max();
+
+	// Event point of the Bentley - Ottmann sweep: an end point (second == No_Segment, first is the event index 2i or 2i + 1),
+	// or the crossing of the supporting lines of the segments first and second.
+	struct Sweep_Point
+	{
+		size_t first;
+		size_t second;
+
+		Sweep_Point() : first(0), second(No_Segment)
+		{
+		}
+
+		explicit Sweep_Point(size_t event) : first(event), second(No_Segment)
+		{
+		}
+
+		Sweep_Point(size_t a, size_t b) : first(std::min(a, b)), second(std::max(a, b))
+		{
+		}
+
+		bool IsCrossing() const
+		{
+			return second != No_Segment;
+		}
+	};
+
+	struct Pairs_State
+	{
+		const Segment_Intersection_Sweep& sweep;
+		std::vector<Line> lines;
+		std::vector<char> vertical;
+		std::vector<char> bundle;
+		Sweep_Point point;
+
+		Pairs_State(const Segment_Intersection_Sweep& sweep) : sweep(sweep), lines(sweep.left.size()), vertical(sweep.left.size(), false), bundle(sweep.left.size(), false)
+		{
+			typename K::Construct_line_2 constructLine = sweep.kernel.construct_line_2_object();
+			typename K::Compare_x_2 compareX = sweep.kernel.compare_x_2_object();
+			for (size_t i = 0; i < sweep.left.size(); i++)
+			{
+				if (!sweep.degenerate[i])
+				{
+					lines[i] = constructLine(sweep.left[i], sweep.right[i]);
+					vertical[i] = compareX(sweep.left[i], sweep.right[i]) == CGAL::EQUAL;
+				}
+			}
+		}
+
+		// Lexicographic order of two event points.
+		CGAL::Comparison_result Compare(const Sweep_Point& a, const Sweep_Point& b) const
+		{
+			if (!a.IsCrossing() && !b.IsCrossing())
+			{
+				return sweep.kernel.compare_xy_2_object()(sweep.EventPoint(a.first), sweep.EventPoint(b.first));
+			}
+			if (!a.IsCrossing())
+			{
+				const Point& p = sweep.EventPoint(a.first);
+				CGAL::Comparison_result order = sweep.kernel.compare_x_2_object()(p, lines[b.first], lines[b.second]);
+				return order != CGAL::EQUAL ? order : sweep.kernel.compare_y_2_object()(p, lines[b.first], lines[b.second]);
+			}
+			if (!b.IsCrossing())
+			{
+				return CGAL::Comparison_result(-Compare(b, a));
+			}
+			CGAL::Comparison_result order = sweep.kernel.compare_x_2_object()(lines[a.first], lines[a.second], lines[b.first], lines[b.second]);
+			return order != CGAL::EQUAL ? order : sweep.kernel.compare_y_2_object()(lines[a.first], lines[a.second], lines[b.first], lines[b.second]);
+		}
+
+		// Position of an event point relative to a non - vertical segment that spans its x - coordinate:
+		// POSITIVE above, NEGATIVE below, ZERO on the segment.
+		CGAL::Sign Side(const Sweep_Point& p, size_t segment) const
+		{
+			if (!p.IsCrossing())
+			{
+				return CGAL::Sign(sweep.kernel.orientation_2_object()(sweep.left[segment], sweep.right[segment], sweep.EventPoint(p.first)));
+			}
+			return CGAL::Sign(sweep.kernel.compare_y_at_x_2_object()(lines[p.first], lines[p.second], lines[segment]));
+		}
+
+		// Two segments through a common point are collinear exactly when their slopes are equal.
+		bool Collinear(size_t a, size_t b) const
+		{
+			return sweep.kernel.compare_slope_2_object()(lines[a], lines[b]) == CGAL::EQUAL;
+		}
+
+		// The segments cross at a point interior to both (touchings and overlaps are found at end point events).
+		bool Cross(size_t a, size_t b) const
+		{
+			typename K::Orientation_2 orientation = sweep.kernel.orientation_2_object();
+			CGAL::Orientation o1 = orientation(sweep.left[a], sweep.right[a], sweep.left[b]);
+			CGAL::Orientation o2 = orientation(sweep.left[a], sweep.right[a], sweep.right[b]);
+			if (o1 == CGAL::COLLINEAR || o2 == CGAL::COLLINEAR || o1 == o2)
+			{
+				return false;
+			}
+			CGAL::Orientation o3 = orientation(sweep.left[b], sweep.right[b], sweep.left[a]);
+			CGAL::Orientation o4 = orientation(sweep.left[b], sweep.right[b], sweep.right[a]);
+			return o3 != CGAL::COLLINEAR && o4 != CGAL::COLLINEAR && o3 != o4;
+		}
+	};
+
+	// Compared against the segments of the status, the probe stands for the given event point.
+	struct Pairs_Probe
+	{
+		Sweep_Point point;
+
+		explicit Pairs_Probe(const Sweep_Point& point) : point(point)
+		{
+		}
+	};
+
+	// Orders the non - vertical segments of the status from bottom to top along the sweep line. The segments of the
+	// bundle (through the event point, being inserted) are ordered by slope, collinear ones by index; the others are
+	// only compared with them and with probes.
+	struct Pairs_Less
+	{
+		typedef void is_transparent;
+
+		const Pairs_State* state;
+
+		Pairs_Less(const Pairs_State* state) : state(state)
+		{
+		}
+
+		bool operator()(size_t a, size_t b) const
+		{
+			if (a == b)
+			{
+				return false;
+			}
+			bool inBundleA = state->bundle[a];
+			bool inBundleB = state->bundle[b];
+			if (inBundleA && inBundleB)
+			{
+				CGAL::Comparison_result slope = state->sweep.kernel.compare_slope_2_object()(state->lines[a], state->lines[b]);
+				return slope == CGAL::EQUAL ? a < b : slope == CGAL::SMALLER;
+			}
+			if (inBundleA)
+			{
+				return state->Side(state->point, b) == CGAL::NEGATIVE;
+			}
+			if (inBundleB)
+			{
+				return state->Side(state->point, a) == CGAL::POSITIVE;
+			}
+			return a < b;
+		}
+
+		bool operator()(size_t segment, const Pairs_Probe& probe) const
+		{
+			return state->Side(probe.point, segment) == CGAL::POSITIVE;
+		}
+
+		bool operator()(const Pairs_Probe& probe, size_t segment) const
+		{
+			return state->Side(probe.point, segment) == CGAL::NEGATIVE;
+		}
+	};
+
+	typedef std::set<size_t, Pairs_Less> Pairs_Status;
+
+	// Crossing events, ordered lexicographically by their (never constructed) points; crossings at the same point are
+	// one event.
+	struct Crossing_Less
+	{
+		const Pairs_State* state;
+
+		Crossing_Less(const Pairs_State* state) : state(state)
+		{
+		}
+
+		bool operator()(const Sweep_Point& a, const Sweep_Point& b) const
+		{
+			return state->Compare(a, b) == CGAL::SMALLER;
+		}
+	};
+
+	// Adds the crossing of two segments that became adjacent in the status, if it is ahead of the sweep.
+	void ScheduleCrossing(const Pairs_State& state, std::set<Sweep_Point, Crossing_Less>& crossings, size_t a, size_t b) const
+	{
+		if (state.Cross(a, b))
+		{
+			Sweep_Point crossing(a, b);
+			if (state.Compare(crossing, state.point) == CGAL::LARGER)
+			{
+				crossings.insert(crossing);
+			}
+		}
+	}
+
+	// Reports the status segments that meet the vertical segment v: at its bottom end point the ones that started left
+	// of it, at its top end point (after the status has been updated there) the ones that started on it. The status
+	// segments are ordered by their height on the vertical line, so they are found by a walk from its bottom end point.
+	template <class Output>
+	void ReportVertical(const Pairs_State& state, const Pairs_Status& status, size_t v, bool atTop, Output output) const
+	{
+		typename K::Compare_x_2 compareX = kernel.compare_x_2_object();
+		Sweep_Point bottom(2 * v);
+		Sweep_Point top(2 * v + 1);
+		for (typename Pairs_Status::const_iterator it = status.lower_bound(Pairs_Probe(bottom)); it != status.end() && state.Side(top, *it) != CGAL::NEGATIVE; ++it)
+		{
+			if ((compareX(left[*it], left[v]) == CGAL::EQUAL) == atTop && Intersect(v, *it))
+			{
+				output(std::min(v, *it), std::max(v, *it));
+			}
+		}
+	}
+
+	// Vertical segments only meet each other in collinear overlaps: in the order of their bottom end points, each one
+	// overlaps the earlier ones on the same vertical line whose top end point is above its bottom one.
+	template <class Output>
+	void ReportVerticalOverlaps(std::vector<size_t> verticals, Output output) const
+	{
+		typename K::Compare_xy_2 compareXY = kernel.compare_xy_2_object();
+		typename K::Compare_x_2 compareX = kernel.compare_x_2_object();
+		std::sort(verticals.begin(), verticals.end(), [this, &compareXY](size_t a, size_t b)
+		{
+			return compareXY(left[a], left[b]) == CGAL::SMALLER;
+		});
+		std::vector<size_t> active;
+		for (size_t k = 0; k < verticals.size(); k++)
+		{
+			size_t v = verticals[k];
+			active.erase(std::remove_if(active.begin(), active.end(), [this, v, &compareXY, &compareX](size_t a)
+			{
+				return compareX(left[a], left[v]) != CGAL::EQUAL || compareXY(right[a], left[v]) != CGAL::LARGER;
+			}), active.end());
+			for (size_t m = 0; m < active.size(); m++)
+			{
+				output(std::min(active[m], v), std::max(active[m], v));
+			}
+			active.push_back(v);
+		}
+	}
+
+	const Point& EventPoint(size_t event) const
+	{
+		return event % 2 == 0 ? left[event / 2] : right[event / 2];
+	}
+
+	bool Report(size_t a, size_t b, Segment_Index_Pair* witness) const
+	{
+		if (witness != nullptr)
+		{
+			*witness = Segment_Index_Pair(std::min(a, b), std::max(a, b));
+		}
+		return true;
+	}
+
+	bool Check(size_t a, size_t b, Segment_Index_Pair* witness) const
+	{
+		return Intersect(a, b) && Report(a, b, witness);
+	}
+
+	K kernel;
+	std::vector<Point> left;
+	std::vector<Point> right;
+	std::vector<char> degenerate;
+};
+#endif
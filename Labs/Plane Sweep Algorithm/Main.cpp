@@ -1,28 +1,55 @@
-// Linker to Header File
-#include "PlaneSweep.h"
-
-int main()
-{
-    std::cout << "Generate a random set of 6 points between 0-10:" << std::endl;
-    Vector_Point_2D instance = Generate2DInstance(0, 10, 6);
-    std::cout << "--------------------------------------------------" << std::endl;
-    std::cout << "Displaying points:" << std::endl;
-    DisplayVector(instance, 3);
-    std::cout << "--------------------------------------------------" << std::endl;
-    
-    std::cout << "Map points to consequential line segments:" << std::endl;
-    std::cout << "--------------------------------------------------" << std::endl;
-    Vector_Line_Segment_2D lineSegments = MapPointsToSegments(instance);
-    std::cout << "Displaying line segments:" << std::endl;
-    DisplayLineSegments(lineSegments, 3);
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    std::cout << "Plane sweep line algorithm for segment line intersection:" << std::endl;
-    Vector_Point_2D intersectionPoints = findSegmentLineIntersection(lineSegments);
-    std::cout << "--------------------------------------------------" << std::endl;
-    std::cout << "Displaying intersection points:" << std::endl;
-    DisplayVector(intersectionPoints, 3);
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    return 0;
+// Linker to Header File
+#include "PlaneSweep.h"
+
+int main()
+{
+    std::cout << "Generate a random set of 6 points between 0-10:" << std::endl;
+    Vector_Point_2D instance = GeneratePoints2DInstance(0, 10, 6);
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "Displaying points:" << std::endl;
+    DisplayPoints(instance, 3);
+    std::cout << "--------------------------------------------------" << std::endl;
+    
+    std::cout << "Map points to consequential line segments:" << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+    Vector_Line_Segment_2D lineSegments = MapPointsToSegments(instance);
+    std::cout << "Displaying line segments:" << std::endl;
+    DisplayLineSegments(lineSegments, 3);
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Plane sweep line algorithm for segment line intersection:" << std::endl;
+    Vector_Point_2D intersectionPoints = findSegmentLineIntersection(lineSegments);
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "Displaying intersection points:" << std::endl;
+    DisplayPoints(intersectionPoints, 3);
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Intersecting pairs of line segments (the sweep constructs no point; each point below is constructed on request):" << std::endl;
+    Segment_Index_Pair witness;
+    if (anySegmentLineIntersection(lineSegments, &witness))
+    {
+        std::cout << "First pair found by the sweep : (" << witness.first << ", " << witness.second << ")" << std::endl;
+    }
+    Segment_Intersection_Report report(lineSegments);
+    for (size_t i = 0; i < report.Size(); i++)
+    {
+        // The intersection point of a pair is only constructed here, when it is asked for.
+        Point_2D point = report.Point(i);
+        std::cout << "(" << report.Pair(i).first << ", " << report.Pair(i).second << ") at "
+            << std::fixed << std::setprecision(3) << "(" << point.x() << "," << point.y() << ")" << std::endl;
+    }
+    std::cout << "Number of intersecting pairs : " << report.Size() << ",  Intersections constructed : " << report.Constructions() << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Bentley - Ottmann sweep over flat containers:" << std::endl;
+    Vector_Point_2D flatIntersectionPoints = findSegmentLineIntersectionFlat(lineSegments);
+    std::cout << "Same points as the surface sweep : " << (flatIntersectionPoints == intersectionPoints ? "yes" : "no") << std::endl;
+    if (flatIntersectionPoints != intersectionPoints || !crossCheckSegmentLineIntersectionFlat(500, 2021))
+    {
+        return 1;
+    }
+    std::cout << "Cross check on 500 random instances : passed" << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    return 0;
 }
\ No newline at end of file
@@ -1,85 +1,167 @@
-// Linker to Header File
-#include "PlaneSweep.h"
-
-Vector_Point_2D Generate2DInstance(int minBound, int maxBound, int nrOfElements)
-{
-	// A random number generator that produces non-deterministic random numbers, if supported.
-	// Unlike the other standard generators, this is not meant to be an engine that generates pseudo - random numbers, 
-	// but a generator based on stochastic processes to generate a sequence of uniformly distributed random numbers.
-	// https://www.cplusplus.com/reference/random/random_device/
-	std::random_device randomDevice;
-
-	// This is a random number engine class that generates pseudo-random numbers.
-	// It is the library implemention's selection of a generator that provides at least acceptable 
-	// engine behavior for relatively casual, inexpert, and/or lightweight use.
-	// https://www.cplusplus.com/reference/random/default_random_engine/
-	std::default_random_engine randomEngine(randomDevice());
-
-	// This distribution (also know as rectangular distribution) produces random numbers in a range [a,b) 
-	// where all intervals of the same length within it are equally probable.
-	// https://www.cplusplus.com/reference/random/uniform_real_distribution/
-	std::uniform_real_distribution<> rectangularDistribution(minBound, maxBound);
-
-	// std::fixed
-	// Use fixed floating-point notation (function )
-	// std::setprecision(int)
-	// Sets the decimal precision to be used to format floating - point values on output operations.
-	// https://www.cplusplus.com/reference/iomanip/setprecision/
-
-	Vector_Point_2D randomPoints;
-
-	for (int n = 0; n < nrOfElements; n++)
-	{
-		double x;
-		double y;
-		x = rectangularDistribution(randomEngine);
-		y = rectangularDistribution(randomEngine);
-
-		// vector::push_back(<T> value)
-		// Adds a new element at the end of the vector, after its current last element. The content of val is copied (or moved) to the new element.
-		// https://www.cplusplus.com/reference/vector/vector/push_back/
-		randomPoints.push_back(Point_2D(x, y));
-	}
-	return randomPoints;
-}
-
-void DisplayVector(Vector_Point_2D vector, int precission)
-{
-	for (int i = 0; i < vector.size(); i++)
-	{
-		std::cout << std::fixed << std::setprecision(precission) << "(" << vector[i][0] << "," << vector[i][1] << ")" << std::endl;
-	}
-}
-
-Vector_Line_Segment_2D MapPointsToSegments(Vector_Point_2D vector) 
-{
-	Vector_Line_Segment_2D lineSegments;
-
-	for (int i = 0; i < vector.size() - 1; i++) 
-	{
-		Point_2D pointA = vector[i];
-		Point_2D pointB = vector[i+1];
-		Line_Segment_2D segmentAB = Line_Segment_2D(pointA, pointB);
-		lineSegments.push_back(segmentAB);
-	}
-
-	return lineSegments;
-}
-
-void DisplayLineSegments(Vector_Line_Segment_2D LineSegments, int precission)
-{
-	for (int i = 0; i < LineSegments.size(); i++)
-	{
-		Point_2D pointSource = LineSegments[i].source();
-		Point_2D pointTarget = LineSegments[i].target();
-		std::cout << std::fixed << std::setprecision(precission) << "Line segment: source (" << pointSource.x() << "," << pointSource.y() << "), target (" << pointTarget.x() << "," 
-			<< pointTarget.y() << ")" << std::endl;
-	}
-}
-
-Vector_Point_2D findSegmentLineIntersection(Vector_Line_Segment_2D LineSegments)
-{
-	Vector_Point_2D intersectionPoints;
-	CGAL::compute_intersection_points(LineSegments.begin(), LineSegments.end(),std::back_inserter(intersectionPoints));
-	return intersectionPoints;
+// Linker to Header File
+#include "PlaneSweep.h"
+
+Vector_Line_Segment_2D MapPointsToSegments(Vector_Point_2D vector) 
+{
+	Vector_Line_Segment_2D lineSegments;
+
+	for (int i = 0; i < vector.size() - 1; i++) 
+	{
+		Point_2D pointA = vector[i];
+		Point_2D pointB = vector[i+1];
+		Line_Segment_2D segmentAB = Line_Segment_2D(pointA, pointB);
+		lineSegments.push_back(segmentAB);
+	}
+
+	return lineSegments;
+}
+
+Vector_Point_2D findSegmentLineIntersection(Vector_Line_Segment_2D LineSegments)
+{
+	Vector_Point_2D intersectionPoints;
+	CGAL::compute_intersection_points(LineSegments.begin(), LineSegments.end(),std::back_inserter(intersectionPoints));
+	return intersectionPoints;
+}
+
+Vector_Point_2D findSegmentLineIntersectionFlat(const Vector_Line_Segment_2D& LineSegments)
+{
+	Vector_Point_2D intersectionPoints;
+	Flat_Segment_Sweep<Kernel>(LineSegments).Points([&intersectionPoints](const Point_2D& point)
+	{
+		intersectionPoints.push_back(point);
+	});
+	return intersectionPoints;
+}
+
+bool crossCheckSegmentLineIntersectionFlat(int nrOfInstances, unsigned int seed)
+{
+	std::mt19937 randomEngine(seed);
+	for (int i = 0; i < nrOfInstances; i++)
+	{
+		// Small grids make equal end points, collinear and vertical segments frequent.
+		std::uniform_int_distribution<int> coordinate(0, 3 + i % 12);
+		std::uniform_int_distribution<int> size(2, 60);
+		Vector_Line_Segment_2D segments(size(randomEngine));
+		for (int j = 0; j < segments.size(); j++)
+		{
+			// The surface sweep does not accept degenerate segments.
+			do
+			{
+				segments[j] = Line_Segment_2D(Point_2D(coordinate(randomEngine), coordinate(randomEngine)), Point_2D(coordinate(randomEngine), coordinate(randomEngine)));
+			} while (segments[j].is_degenerate());
+		}
+
+		Vector_Point_2D expected = findSegmentLineIntersection(segments);
+		Vector_Point_2D found = findSegmentLineIntersectionFlat(segments);
+		if (found != expected)
+		{
+			std::cout << "Flat sweep mismatch on instance " << i << std::endl;
+			DisplayLineSegments(segments, 3);
+			std::cout << "Expected:" << std::endl;
+			DisplayPoints(expected, 3);
+			std::cout << "Found:" << std::endl;
+			DisplayPoints(found, 3);
+			return false;
+		}
+	}
+	return true;
+}
+
+bool anySegmentLineIntersection(const Vector_Line_Segment_2D& LineSegments, Segment_Index_Pair* witness)
+{
+	return Segment_Intersection_Sweep<Kernel>(LineSegments).Any(witness);
+}
+
+Vector_Segment_Index_Pair findIntersectingSegmentPairs(const Vector_Line_Segment_2D& LineSegments)
+{
+	Vector_Segment_Index_Pair pairs;
+	Segment_Intersection_Sweep<Kernel>(LineSegments).Pairs([&pairs](size_t i, size_t j)
+	{
+		pairs.push_back(Segment_Index_Pair(i, j));
+	});
+	std::sort(pairs.begin(), pairs.end());
+	return pairs;
+}
+
+size_t countSegmentLineIntersections(const Vector_Line_Segment_2D& LineSegments)
+{
+	size_t count = 0;
+	Segment_Intersection_Sweep<Kernel>(LineSegments).Pairs([&count](size_t, size_t)
+	{
+		count++;
+	});
+	return count;
+}
+
+Segment_Intersection_Report::Segment_Intersection_Report(const Vector_Line_Segment_2D& LineSegments)
+	: segments(LineSegments), constructions(0)
+{
+	Segment_Intersection_Sweep<Kernel>(segments).Pairs([this](size_t i, size_t j)
+	{
+		pairs.push_back(Segment_Index_Pair(i, j));
+	});
+	std::sort(pairs.begin(), pairs.end());
+	intersections.resize(pairs.size());
+}
+
+size_t Segment_Intersection_Report::Size() const
+{
+	return pairs.size();
+}
+
+const Segment_Index_Pair& Segment_Intersection_Report::Pair(size_t k) const
+{
+	return pairs[k];
+}
+
+const Vector_Segment_Index_Pair& Segment_Intersection_Report::Pairs() const
+{
+	return pairs;
+}
+
+const Segment_Intersection_2D& Segment_Intersection_Report::Intersection(size_t k) const
+{
+	if (!intersections[k])
+	{
+		intersections[k].reset(new Segment_Intersection_2D(CGAL::intersection(segments[pairs[k].first], segments[pairs[k].second])));
+		constructions++;
+	}
+	return *intersections[k];
+}
+
+Point_2D Segment_Intersection_Report::Point(size_t k) const
+{
+	const Segment_Intersection_2D& result = Intersection(k);
+	if (const Point_2D* point = boost::get<Point_2D>(&*result))
+	{
+		return *point;
+	}
+	return boost::get<Line_Segment_2D>(&*result)->min();
+}
+
+Vector_Point_2D Segment_Intersection_Report::Points() const
+{
+	Vector_Point_2D points;
+	for (size_t k = 0; k < pairs.size(); k++)
+	{
+		const Segment_Intersection_2D& result = Intersection(k);
+		if (const Point_2D* point = boost::get<Point_2D>(&*result))
+		{
+			points.push_back(*point);
+		}
+		else
+		{
+			const Line_Segment_2D* overlap = boost::get<Line_Segment_2D>(&*result);
+			points.push_back(overlap->min());
+			points.push_back(overlap->max());
+		}
+	}
+	std::sort(points.begin(), points.end());
+	points.erase(std::unique(points.begin(), points.end()), points.end());
+	return points;
+}
+
+size_t Segment_Intersection_Report::Constructions() const
+{
+	return constructions;
 }
\ No newline at end of file
@@ -1,105 +1,163 @@
-//Header guards
-//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
-
-// CGAL Convex Hull Libraries (2D)
-// https://doc.cgal.org/5.0.4/Convex_hull_2/
-
-#ifndef PLANE_SWEEP_H
-#define PLANE_SWEEP_H
-
-// General C++ Standard Libraries
-// * Header that defines the standard input/output stream objects
-#include <iostream>
-
-// * Vectors are sequence containers representing arrays that can change in size.
-// * https://www.cplusplus.com/reference/vector/vector/
-#include <vector>
-
-// * This header introduces random number generation facilities.
-// * https://www.cplusplus.com/reference/random/
-#include <random>
-
-// * Header providing parametric manipulators :
-// * https://www.cplusplus.com/reference/iomanip/
-#include <iomanip>
-
-// --------------------------------------------------------------------
-
-// Predefined Kernel:
-// * Exact Geometric Predicates Exact Geometric Constructions 
-// * It uses Cartesian representation.
-// * It supports constructions of points from double Cartesian coordinates.
-// * It provides both exact geometric predicates and exact geometric constructions.
-// * https://doc.cgal.org/latest/Kernel_23/classCGAL_1_1Exact__predicates__exact__constructions__kernel.html
-#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
-
-// Traits:
-// * The traits class "Arr_segment_traits_2" is a model of the ArrangementTraits_2 concept, which allows 
-// * the construction and maintenance of arrangements of line segments.
-// https://doc.cgal.org/latest/Arrangement_on_surface_2/classCGAL_1_1Arr__segment__traits__2.html
-#include <CGAL/Arr_segment_traits_2.h>
-
-// Curve Intersection Algorithm:
-// * Outpout - sensitive sweep - plane algorithm that reports all the intersections between curves.
-// * Given that any curve can be represented with high - approximation ratio as a set of continuous line segments, these
-// * algorithm reports all intersections for any set of given line segments.
-// * https://doc.cgal.org/latest/Surface_sweep_2/index.html#Chapter_2D_Intersection_of_Curves
-#include <CGAL/Surface_sweep_2_algorithms.h>
-
-// --------------------------------------------------------------------
-
-// Naming Conventions for simplicity
-// * Kernel : CGAL::Exact_predicates_exact_constructions_kernel
-typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
-
-// * Point_2D : Kernel::Point_2
-typedef Kernel::Point_2 Point_2D;
-
-// * Traits_2D : CGAL::Arr_segment_traits_2<Kernel>
-typedef CGAL::Arr_segment_traits_2<Kernel> Traits_2D;
-
-// * Line_Segment_2D : Kernel::Segment_2
-typedef Kernel::Segment_2 Line_Segment_2D;
-
-// * Vector_2D : std::vector<Point_2D>
-typedef std::vector<Point_2D> Vector_Point_2D;
-
-// * Vector_2D : std::vector<Point_2D>
-typedef std::vector<Line_Segment_2D> Vector_Line_Segment_2D;
-
-// --------------------------------------------------------------------
-
-/*
-* This function is responsible for generating a random set of 2D points using the rectangular distribution.
-* It takes as input parameters the minimum bound, the maximum bound as well as the number of desired points
-* to be generated and returns a vector of 2D - points containing elements in range [a,b)x[a,b).
-*/
-Vector_Point_2D Generate2DInstance(int minBound, int maxBound, int nrOfElements);
-
-/*
-* This function is responsible for displaying in the screen a complete list of a 2D-points vector, given
-* the desired fixed precission.
-*/
-void DisplayVector(Vector_Point_2D vector, int precission);
-
-/*
-* This function is responsible for returning a vector of line segments that corresponds 
-* to the given vector of 2D - points.
-* Example:
-* Input 2D - point vector : ((xa,ya), (xb,yb), (xc,yc), (xd,yd), ...)
-* Outpout: A vector of the line segments: ((xa,ya) - (xb,yb)), ((xb,yb) - (xc,yc)), ((xc,yc) - (xd,yd)), ((xd,yd) - ...
-*/
-Vector_Line_Segment_2D MapPointsToSegments(Vector_Point_2D vector);
-
-/*
-* This function is responsible for displaying in the screen a complete list of a 2D-line segment vector, given
-* the desired fixed precission.
-*/
-void DisplayLineSegments(Vector_Line_Segment_2D LineSegments, int precission);
-
-/*
-* This function is responsible for using the sweep plane algorithm, to find all the points where 
-* the given line segments intersect. 
-*/
-Vector_Point_2D findSegmentLineIntersection(Vector_Line_Segment_2D LineSegments);
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// CGAL Convex Hull Libraries (2D)
+// https://doc.cgal.org/5.0.4/Convex_hull_2/
+
+#ifndef PLANE_SWEEP_H
+#define PLANE_SWEEP_H
+
+// Common geometry types (Kernel, Point_2D, Line_Segment_2D, vectors) and helpers
+#include "Geometry.h"
+
+// --------------------------------------------------------------------
+
+// Traits:
+// * The traits class "Arr_segment_traits_2" is a model of the ArrangementTraits_2 concept, which allows 
+// * the construction and maintenance of arrangements of line segments.
+// https://doc.cgal.org/latest/Arrangement_on_surface_2/classCGAL_1_1Arr__segment__traits__2.html
+#include <CGAL/Arr_segment_traits_2.h>
+
+// Curve Intersection Algorithm:
+// * Outpout - sensitive sweep - plane algorithm that reports all the intersections between curves.
+// * Given that any curve can be represented with high - approximation ratio as a set of continuous line segments, these
+// * algorithm reports all intersections for any set of given line segments.
+// * https://doc.cgal.org/latest/Surface_sweep_2/index.html#Chapter_2D_Intersection_of_Curves
+#include <CGAL/Surface_sweep_2_algorithms.h>
+
+// Object - intersection of two segments (used to construct the reported intersections on demand)
+// * https://doc.cgal.org/5.0.4/Kernel_23/group__intersection__linear__grp.html
+#include <CGAL/intersections.h>
+
+// * Header that defines smart pointers (std::unique_ptr) for dynamic memory management.
+// * https://www.cplusplus.com/reference/memory/
+#include <memory>
+
+// Predicate only sweeps: any intersection (Shamos - Hoey) and intersecting segment pairs
+#include "IntersectionSweep.h"
+
+// Bentley - Ottmann sweep over a flat event heap and a blocked status line
+#include "FlatSweep.h"
+
+// --------------------------------------------------------------------
+
+// Naming Conventions for simplicity
+// * Traits_2D : CGAL::Arr_segment_traits_2<Kernel>
+typedef CGAL::Arr_segment_traits_2<Kernel> Traits_2D;
+
+// * Segment_Intersection_2D : the intersection of two segments, empty, a point or (collinear overlap) a segment
+// * boost::optional<boost::variant<Point_2D, Line_Segment_2D>>
+typedef CGAL::cpp11::result_of<Kernel::Intersect_2(Line_Segment_2D, Line_Segment_2D)>::type Segment_Intersection_2D;
+
+// --------------------------------------------------------------------
+
+/*
+* This function is responsible for returning a vector of line segments that corresponds 
+* to the given vector of 2D - points.
+* Example:
+* Input 2D - point vector : ((xa,ya), (xb,yb), (xc,yc), (xd,yd), ...)
+* Outpout: A vector of the line segments: ((xa,ya) - (xb,yb)), ((xb,yb) - (xc,yc)), ((xc,yc) - (xd,yd)), ((xd,yd) - ...
+*/
+Vector_Line_Segment_2D MapPointsToSegments(Vector_Point_2D vector);
+
+/*
+* This function is responsible for using the sweep plane algorithm, to find all the points where 
+* the given line segments intersect. 
+*/
+Vector_Point_2D findSegmentLineIntersection(Vector_Line_Segment_2D LineSegments);
+
+/*
+* This function is responsible for finding the same points as findSegmentLineIntersection, in the same order, with the
+* Bentley - Ottmann sweep of FlatSweep.h: the events are kept in a binary heap stored in one vector and the status line in
+* small sorted arrays, so the sweep allocates few nodes and walks contiguous memory. Meant for large inputs with few
+* intersections per segment, where the sweep structures dominate the running time. The arrangement construction
+* (CGAL::insert) still runs the CGAL surface sweep.
+*/
+Vector_Point_2D findSegmentLineIntersectionFlat(const Vector_Line_Segment_2D& LineSegments);
+
+/*
+* This function is responsible for cross checking findSegmentLineIntersectionFlat against findSegmentLineIntersection
+* on the given number of seeded random instances of segments with small integer end points (so that shared end points,
+* vertical and overlapping segments are frequent). Returns false, and displays the first mismatch, if they ever differ.
+*/
+bool crossCheckSegmentLineIntersectionFlat(int nrOfInstances, unsigned int seed);
+
+/*
+* This function is responsible for deciding whether any two of the given line segments intersect, i.e. whether
+* findSegmentLineIntersection would report at least one point. Segments that only share an end point do not intersect,
+* so this validates that the segments form a planar subdivision. The sweep stops at the first intersection and no point
+* is constructed. If witness is given, the indices of an intersecting pair are written to it.
+*/
+bool anySegmentLineIntersection(const Vector_Line_Segment_2D& LineSegments, Segment_Index_Pair* witness = nullptr);
+
+/*
+* This function is responsible for returning the indices (i, j), with i < j and in lexicographic order, of all the pairs
+* of the given line segments that intersect, without constructing the intersection points. The pairs are found by a
+* Bentley - Ottmann sweep that only evaluates predicates (Segment_Intersection_Sweep::Pairs), in O((n + k)logn) time for
+* k intersecting pairs. Use anySegmentLineIntersection to only validate an input.
+*/
+Vector_Segment_Index_Pair findIntersectingSegmentPairs(const Vector_Line_Segment_2D& LineSegments);
+
+/*
+* This function is responsible for counting the pairs of the given line segments that intersect, without constructing
+* the intersection points, with the same sweep (and time bound) as findIntersectingSegmentPairs. Note that
+* it counts pairs: k segments through a common point count as k(k-1)/2, where findSegmentLineIntersection reports the
+* point once.
+*/
+size_t countSegmentLineIntersections(const Vector_Line_Segment_2D& LineSegments);
+
+/*
+* This class is responsible for reporting which of the given line segments intersect, as index pairs, with the geometry
+* of the intersections deferred: the pairs come from the predicate only Bentley - Ottmann sweep of
+* Segment_Intersection_Sweep::Pairs (O((n + k)logn) time for k pairs), and the intersection of a pair is constructed the
+* first time it is requested and then cached. Consumers that only need the topology (which segments cross which) never
+* pay for an exact construction.
+*/
+class Segment_Intersection_Report
+{
+public:
+	Segment_Intersection_Report(const Vector_Line_Segment_2D& LineSegments);
+
+	/*
+	* Number of intersecting pairs.
+	*/
+	size_t Size() const;
+
+	/*
+	* The indices (i, j), i < j, of the k - th intersecting pair; pairs are in lexicographic order.
+	*/
+	const Segment_Index_Pair& Pair(size_t k) const;
+	const Vector_Segment_Index_Pair& Pairs() const;
+
+	/*
+	* The intersection of the k - th pair (a point, or a segment for collinear overlaps), constructed on first request.
+	*/
+	const Segment_Intersection_2D& Intersection(size_t k) const;
+
+	/*
+	* A point of the intersection of the k - th pair: the crossing point, or the lexicographically smallest point of an
+	* overlap.
+	*/
+	Point_2D Point(size_t k) const;
+
+	/*
+	* The distinct points of the intersections of all the pairs, sorted lexicographically: every crossing point, every
+	* point where an end point of one segment touches the interior of the other, and both ends of every collinear
+	* overlap, even where such an end is an end point of both segments of the pair. This is a set defined by the pairs,
+	* not by the surface sweep, so it is not guaranteed to equal the points of findSegmentLineIntersection.
+	* Constructs every intersection that is not cached yet.
+	*/
+	Vector_Point_2D Points() const;
+
+	/*
+	* Number of intersections constructed so far.
+	*/
+	size_t Constructions() const;
+
+private:
+	Vector_Line_Segment_2D segments;
+	Vector_Segment_Index_Pair pairs;
+	mutable std::vector<std::unique_ptr<Segment_Intersection_2D>> intersections;
+	mutable size_t constructions;
+};
 #endif
\ No newline at end of file
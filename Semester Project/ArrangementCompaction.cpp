@@ -0,0 +1,132 @@
+// Linker to Header File
+#include "ArrangementCompaction.h"
+
+namespace
+{
+	// Returns true if the interval approximation of the given number is a single double, that is if the number is one.
+	bool IsDouble(const Kernel::FT& number, double& value)
+	{
+		// CGAL::to_interval
+		// Returns the interval approximation of a number; it is a single double if and only if the number is a double.
+		// https://doc.cgal.org/5.0.4/Algebraic_foundations/group__PkgAlgebraicFoundationsRef.html
+		std::pair<double, double> interval = CGAL::to_interval(number);
+		value = interval.first;
+		return interval.first == interval.second;
+	}
+
+	bool HasDoubleCoordinates(const Point_2D& point, double& x, double& y)
+	{
+		return IsDouble(point.x(), x) && IsDouble(point.y(), y);
+	}
+
+	bool HasDoubleCoefficients(const Kernel::Line_2& line, double& a, double& b, double& c)
+	{
+		return IsDouble(line.a(), a) && IsDouble(line.b(), b) && IsDouble(line.c(), c);
+	}
+
+	// The compact form of a vertex point: fresh doubles if its value is a double, else its pruned exact value.
+	// A point whose interval is already a single double is rebuilt without computing its exact value at all.
+	Point_2D CompactPoint(const Point_2D& point, bool& isDouble)
+	{
+		double x;
+		double y;
+		isDouble = HasDoubleCoordinates(point, x, y);
+		if (!isDouble)
+		{
+			// CGAL::exact
+			// Computes the exact value of a lazy object, which replaces (prunes) its construction DAG, and tightens its
+			// interval approximation to the exact value.
+			CGAL::exact(point);
+			isDouble = HasDoubleCoordinates(point, x, y);
+		}
+		return isDouble ? Point_2D(x, y) : point;
+	}
+
+	Kernel::Line_2 CompactLine(const Kernel::Line_2& line, bool& isDouble)
+	{
+		double a;
+		double b;
+		double c;
+		isDouble = HasDoubleCoefficients(line, a, b, c);
+		if (!isDouble)
+		{
+			CGAL::exact(line);
+			isDouble = HasDoubleCoefficients(line, a, b, c);
+		}
+		return isDouble ? Kernel::Line_2(a, b, c) : line;
+	}
+}
+
+Compaction_Report CompactArrangment(Arrangement_2D& arr)
+{
+	Compaction_Report report;
+	report.vertices = arr.number_of_vertices();
+	report.doubleVertices = 0;
+	report.edges = arr.number_of_edges();
+	report.doubleLines = 0;
+	report.queries = 0;
+	report.querySecondsBefore = 0;
+	report.querySecondsAfter = 0;
+	ReleaseFreeHeapMemory();
+	report.heapBytesBefore = CurrentHeapBytes();
+	report.residentBytesBefore = CurrentResidentBytes();
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	// Arrangement_2::modify_vertex
+	// Replaces the point of a vertex by an equal point.
+	// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arrangement__2.html
+	for (Arrangement_2D::Vertex_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+	{
+		bool isDouble;
+		Point_2D point = CompactPoint(v->point(), isDouble);
+		if (isDouble)
+		{
+			arr.modify_vertex(v, point);
+			report.doubleVertices++;
+		}
+	}
+
+	// Arrangement_2::modify_edge
+	// Replaces the curve of an edge by an equal curve. The new curve shares the (compacted) points of its end vertices,
+	// so the old end points and the old supporting line are released.
+	for (Arrangement_2D::Edge_iterator e = arr.edges_begin(); e != arr.edges_end(); e++)
+	{
+		bool isDouble;
+		const Arr_Curve_2D& curve = e->curve();
+		Kernel::Line_2 line = CompactLine(curve.line(), isDouble);
+		report.doubleLines += isDouble ? 1 : 0;
+
+		// The curve runs from its left end to its right end when it is directed right, the halfedge when its direction
+		// is ARR_LEFT_TO_RIGHT.
+		Arrangement_2D::Vertex_handle left = e->direction() == CGAL::ARR_LEFT_TO_RIGHT ? e->source() : e->target();
+		Arrangement_2D::Vertex_handle right = e->direction() == CGAL::ARR_LEFT_TO_RIGHT ? e->target() : e->source();
+		const Point_2D& source = curve.is_directed_right() ? left->point() : right->point();
+		const Point_2D& target = curve.is_directed_right() ? right->point() : left->point();
+		arr.modify_edge(e, Arr_Curve_2D(line, source, target));
+	}
+
+	report.compactSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	ReleaseFreeHeapMemory();
+	report.heapBytesAfter = CurrentHeapBytes();
+	report.residentBytesAfter = CurrentResidentBytes();
+	return report;
+}
+
+void DisplayCompactionReport(const Compaction_Report& report)
+{
+	std::cout << "Vertices : " << report.vertices << " (" << report.doubleVertices << " with double coordinates)"
+		<< ",  Edges : " << report.edges << " (" << report.doubleLines << " with double lines)" << std::endl;
+	std::cout << "Heap bytes : " << report.heapBytesBefore << " -> " << report.heapBytesAfter
+		<< ",  Resident bytes : " << report.residentBytesBefore << " -> " << report.residentBytesAfter << std::endl;
+	std::cout << "Compaction time : " << std::fixed << std::setprecision(3) << report.compactSeconds * 1e3 << " ms" << std::endl;
+	if (report.queries > 0)
+	{
+		std::cout << "Locating " << report.queries << " points : " << report.querySecondsBefore * 1e3 << " ms -> "
+			<< report.querySecondsAfter * 1e3 << " ms";
+		if (report.querySecondsAfter > 0)
+		{
+			std::cout << " (speedup " << std::setprecision(2) << report.querySecondsBefore / report.querySecondsAfter << "x)";
+		}
+		std::cout << std::endl;
+	}
+}
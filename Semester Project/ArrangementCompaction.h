@@ -0,0 +1,85 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Lazy exact numbers of the EPECK kernel
+// https://doc.cgal.org/5.0.4/Kernel_23/classCGAL_1_1Exact__predicates__exact__constructions__kernel.html
+
+#ifndef ARRANGEMENT_COMPACTION_H
+#define ARRANGEMENT_COMPACTION_H
+
+// Linker to Memory Footprint Header File (heap and resident size measurement)
+#include "MemoryFootprint.h"
+
+// --------------------------------------------------------------------
+
+/*
+* The outcome of CompactArrangment. doubleVertices and doubleLines count the vertex points and supporting lines that now
+* hold plain double coordinates (no exact number, no construction history); the others hold their exact value only.
+* The heap and resident sizes are taken right before and right after the pass; the query figures are only filled by
+* CompactArrangmentAndMeasure.
+*/
+struct Compaction_Report
+{
+	size_t vertices;
+	size_t doubleVertices;
+	size_t edges;
+	size_t doubleLines;
+	size_t heapBytesBefore;
+	size_t heapBytesAfter;
+	size_t residentBytesBefore;
+	size_t residentBytesAfter;
+	double compactSeconds;
+	size_t queries;
+	double querySecondsBefore;
+	double querySecondsAfter;
+};
+
+/*
+* This function is responsible for compacting the lazy exact numbers of the given arrangment. A vertex created at an
+* intersection keeps the construction DAG of its coordinates (the two segments it was computed from and every
+* intermediate number), which costs memory and makes an exact fallback of a later predicate walk the whole DAG.
+* The pass evaluates every vertex point and every supporting line exactly once, which drops their construction history,
+* and replaces the ones whose exact value is a double (the input end points, and the intersections that happen to be
+* representable) by fresh double numbers. The geometry does not change.
+* Point location objects attached to the arrangement are notified of every modified vertex and edge, which is slow for
+* the landmarks and trapezoid strategies: compact before attaching them.
+*/
+Compaction_Report CompactArrangment(Arrangement_2D& arr);
+
+/*
+* This function is responsible for returning the time taken by the given strategy to locate the given points on the
+* given arrangment (the strategy is attached before the clock starts).
+*/
+template <class Strategy>
+double MeasureLocateSeconds(const Arrangement_2D& arr, const Vector_Point_2D& points)
+{
+	Strategy pl(arr);
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (int i = 0; i < points.size(); i++)
+	{
+		Location_Result_Type result = pl.locate(points[i]);
+	}
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+/*
+* This function is responsible for compacting the given arrangment (see CompactArrangment) and timing the location of
+* the given sample with the given strategy before and after the pass.
+* Example: Compaction_Report report = CompactArrangmentAndMeasure<Trapezoid_Point_Location>(arr, points);
+*/
+template <class Strategy>
+Compaction_Report CompactArrangmentAndMeasure(Arrangement_2D& arr, const Vector_Point_2D& sample)
+{
+	double querySecondsBefore = MeasureLocateSeconds<Strategy>(arr, sample);
+	Compaction_Report report = CompactArrangment(arr);
+	report.queries = sample.size();
+	report.querySecondsBefore = querySecondsBefore;
+	report.querySecondsAfter = MeasureLocateSeconds<Strategy>(arr, sample);
+	return report;
+}
+
+/*
+* This function is responsible for displaying the given report to the screen.
+*/
+void DisplayCompactionReport(const Compaction_Report& report);
+#endif
@@ -0,0 +1,457 @@
+// Linker to Header File
+#include "ArrangementIO.h"
+
+// Lexicographic comparison of double coordinates
+#include "FilteredPredicates.h"
+
+// * Header that declares the std::rename and std::remove file operations.
+// * https://www.cplusplus.com/reference/cstdio/rename/
+#include <cstdio>
+
+// * Header that declares std::setprecision, and the numeric limits of double.
+// * https://www.cplusplus.com/reference/iomanip/setprecision/
+// * https://www.cplusplus.com/reference/limits/numeric_limits/
+#include <iomanip>
+#include <limits>
+
+// * Header that declares std::strtod.
+// * https://www.cplusplus.com/reference/cstdlib/strtod/
+#include <cstdlib>
+
+// * Mutual exclusion and condition variables, used by the prefetching loader.
+// * https://www.cplusplus.com/reference/mutex/
+// * https://www.cplusplus.com/reference/condition_variable/
+#include <mutex>
+#include <condition_variable>
+
+// * Class to represent individual threads of execution.
+// * https://www.cplusplus.com/reference/thread/thread/
+#include <thread>
+
+// * Double ended queue and array containers.
+// * https://www.cplusplus.com/reference/deque/deque/
+// * https://www.cplusplus.com/reference/array/array/
+#include <deque>
+#include <array>
+
+// * Sets are containers that store unique elements following a specific order.
+// * https://www.cplusplus.com/reference/set/set/
+#include <set>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+namespace
+{
+	const String Section_Separator = "----------------------";
+
+	// The first line of the edge section of a snapshot file.
+	const String Edge_Section = "Edges";
+
+	// Number of parsed records handed from the reader thread to the inserting thread at a time,
+	// and number of such batches that may be waiting.
+	const size_t Records_Per_Batch = 4096;
+	const size_t Batches_In_Flight = 8;
+
+	// One parsed line (vertex) or pair of lines (edge, or face half-edge) of an arrangment file.
+	struct Arrangement_Record
+	{
+		bool isVertex;
+		double x1;
+		double y1;
+		double x2;
+		double y2;
+	};
+
+	typedef std::vector<Arrangement_Record> Record_Batch;
+
+	// A bounded single producer / single consumer queue of record batches.
+	class Record_Batch_Queue
+	{
+	public:
+		Record_Batch_Queue() : finished(false), succeeded(false)
+		{
+		}
+
+		void Push(Record_Batch& batch)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			notFull.wait(lock, [this]() { return batches.size() < Batches_In_Flight; });
+			batches.push_back(std::move(batch));
+			batch = Record_Batch();
+			notEmpty.notify_one();
+		}
+
+		// Called once by the reader: ok is false if the file could not be opened, read or parsed.
+		void Finish(bool ok)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			finished = true;
+			succeeded = ok;
+			notEmpty.notify_one();
+		}
+
+		// Valid once Pop has returned false.
+		bool Succeeded()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return succeeded;
+		}
+
+		bool Pop(Record_Batch& batch)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			notEmpty.wait(lock, [this]() { return !batches.empty() || finished; });
+			if (batches.empty())
+			{
+				return false;
+			}
+			batch = std::move(batches.front());
+			batches.pop_front();
+			notFull.notify_one();
+			return true;
+		}
+
+	private:
+		std::mutex mutex;
+		std::condition_variable notEmpty;
+		std::condition_variable notFull;
+		std::deque<Record_Batch> batches;
+		bool finished;
+		bool succeeded;
+	};
+
+	// Same format as ParseLineToPoint ("x,y" or "x, y"), without constructing a lazy exact point.
+	bool ParseLineToCoordinates(const String& data, double& x, double& y)
+	{
+		const char* text = data.c_str();
+		char* end;
+		x = std::strtod(text, &end);
+		if (end == text || *end != ',')
+		{
+			return false;
+		}
+		const char* second = end + 1;
+		y = std::strtod(second, &end);
+		return end != second;
+	}
+
+	// Reads the file, in order, into the queue: up to the end of the edge section of a snapshot file, or the whole file
+	// written by SaveArrangment. The queue is finished as failed if the file cannot be opened, a read error occurs or a line
+	// is not a coordinate pair (blank lines are skipped).
+	void ReadArrangmentRecords(String path, Record_Batch_Queue& queue)
+	{
+		std::ifstream file(path);
+		if (!file.is_open())
+		{
+			queue.Finish(false);
+			return;
+		}
+		bool ok = true;
+		String data;
+		String next;
+		bool faces = false;
+		bool edges = false;
+		Record_Batch batch;
+		batch.reserve(Records_Per_Batch);
+		while (std::getline(file, data))
+		{
+			if (data == Section_Separator)
+			{
+				if (edges)
+				{
+					// The faces that follow repeat the edges.
+					break;
+				}
+				faces = true;
+				continue;
+			}
+			if (faces && data == Edge_Section)
+			{
+				edges = true;
+				continue;
+			}
+			if (data == "Unbounded" || data.empty())
+			{
+				continue;
+			}
+			Arrangement_Record record;
+			record.isVertex = !faces;
+			record.x2 = 0;
+			record.y2 = 0;
+			if (!ParseLineToCoordinates(data, record.x1, record.y1) ||
+				(faces && !(std::getline(file, next) && ParseLineToCoordinates(next, record.x2, record.y2))))
+			{
+				ok = false;
+				break;
+			}
+			batch.push_back(record);
+			if (batch.size() == Records_Per_Batch)
+			{
+				queue.Push(batch);
+				batch.reserve(Records_Per_Batch);
+			}
+		}
+		if (file.bad())
+		{
+			ok = false;
+		}
+		if (ok && !batch.empty())
+		{
+			queue.Push(batch);
+		}
+		queue.Finish(ok);
+	}
+
+	void AppendFaceBoundary(Arrangement_Snapshot& snapshot, bool unbounded, const std::vector<double>& boundary)
+	{
+		snapshot.faceUnbounded.push_back(unbounded);
+		snapshot.faceCoordinates.insert(snapshot.faceCoordinates.end(), boundary.begin(), boundary.end());
+		snapshot.faceOffsets.push_back(snapshot.faceCoordinates.size());
+	}
+
+	void AppendVerticesAndEdges(Arrangement_Snapshot& snapshot, const Arrangement_2D& arr)
+	{
+		snapshot.vertices.reserve(2 * arr.number_of_vertices());
+		for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+		{
+			snapshot.vertices.push_back(CGAL::to_double(v->point().x()));
+			snapshot.vertices.push_back(CGAL::to_double(v->point().y()));
+		}
+		snapshot.edges.reserve(4 * arr.number_of_edges());
+		for (Arrangement_2D::Edge_const_iterator e = arr.edges_begin(); e != arr.edges_end(); e++)
+		{
+			snapshot.edges.push_back(CGAL::to_double(e->source()->point().x()));
+			snapshot.edges.push_back(CGAL::to_double(e->source()->point().y()));
+			snapshot.edges.push_back(CGAL::to_double(e->target()->point().x()));
+			snapshot.edges.push_back(CGAL::to_double(e->target()->point().y()));
+		}
+		snapshot.faceOffsets.push_back(0);
+	}
+}
+
+Arrangement_Snapshot TakeArrangmentSnapshot(const Arrangement_2D& arr)
+{
+	Arrangement_Snapshot snapshot;
+	AppendVerticesAndEdges(snapshot, arr);
+	std::vector<double> boundary;
+	for (Arrangement_2D::Face_const_iterator f = arr.faces_begin(); f != arr.faces_end(); f++)
+	{
+		boundary.clear();
+		if (!f->is_unbounded())
+		{
+			HalfEdge_circulator circulator = f->outer_ccb();
+			HalfEdge_circulator indexcirculator = circulator;
+			do
+			{
+				boundary.push_back(CGAL::to_double(indexcirculator->source()->point().x()));
+				boundary.push_back(CGAL::to_double(indexcirculator->source()->point().y()));
+				indexcirculator++;
+			} while (indexcirculator != circulator);
+		}
+		AppendFaceBoundary(snapshot, f->is_unbounded(), boundary);
+	}
+	return snapshot;
+}
+
+Arrangement_Snapshot TakeArrangmentSnapshot(Arrangement_2D& arr, Face_Geometry_Cache& cache)
+{
+	Arrangement_Snapshot snapshot;
+	AppendVerticesAndEdges(snapshot, arr);
+	for (Arrangement_2D::Face_const_iterator f = arr.faces_begin(); f != arr.faces_end(); f++)
+	{
+		const Face_Geometry& geometry = cache.Get(f);
+		AppendFaceBoundary(snapshot, geometry.unbounded, geometry.boundary);
+	}
+	return snapshot;
+}
+
+bool WriteArrangmentSnapshot(const Arrangement_Snapshot& snapshot, String path)
+{
+	String temporaryPath = path + ".tmp";
+	std::ofstream myfile(temporaryPath);
+	if (!myfile.is_open())
+	{
+		return false;
+	}
+
+	// Enough digits for every double to be read back as the same double.
+	myfile << std::setprecision(std::numeric_limits<double>::max_digits10);
+	for (size_t i = 0; i + 1 < snapshot.vertices.size(); i += 2)
+	{
+		myfile << snapshot.vertices[i] << "," << snapshot.vertices[i + 1] << '\n';
+	}
+	myfile << Section_Separator << '\n';
+	myfile << Edge_Section << '\n';
+	for (size_t i = 0; i + 3 < snapshot.edges.size(); i += 4)
+	{
+		myfile << snapshot.edges[i] << ", " << snapshot.edges[i + 1] << '\n';
+		myfile << snapshot.edges[i + 2] << ", " << snapshot.edges[i + 3] << '\n';
+	}
+	myfile << Section_Separator << '\n';
+	for (size_t f = 0; f < snapshot.faceUnbounded.size(); f++)
+	{
+		if (snapshot.faceUnbounded[f])
+		{
+			myfile << "Unbounded" << '\n';
+		}
+		else
+		{
+			size_t first = snapshot.faceOffsets[f];
+			size_t n = (snapshot.faceOffsets[f + 1] - first) / 2;
+			for (size_t i = 0; i < n; i++)
+			{
+				size_t j = (i + 1) % n;
+				myfile << snapshot.faceCoordinates[first + 2 * i] << ", " << snapshot.faceCoordinates[first + 2 * i + 1] << "\n";
+				myfile << snapshot.faceCoordinates[first + 2 * j] << ", " << snapshot.faceCoordinates[first + 2 * j + 1] << "\n";
+			}
+		}
+		myfile << Section_Separator << '\n';
+	}
+	myfile.close();
+	if (myfile.fail())
+	{
+		std::remove(temporaryPath.c_str());
+		return false;
+	}
+
+	// std::rename
+	// On POSIX systems, renaming over an existing file replaces it atomically. On Windows the rename fails if path already
+	// exists, so the previous checkpoint is removed first: there the replacement is not atomic, and a crash in between
+	// leaves only "<path>.tmp".
+	// https://www.cplusplus.com/reference/cstdio/rename/
+	if (std::rename(temporaryPath.c_str(), path.c_str()) == 0)
+	{
+		return true;
+	}
+	std::remove(path.c_str());
+	return std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+}
+
+std::future<bool> SaveArrangmentAsync(const Arrangement_2D& arr, String path)
+{
+	// The snapshot is moved into the task, so the background thread owns all the data it reads.
+	return std::async(std::launch::async, [](Arrangement_Snapshot snapshot, String file)
+	{
+		return WriteArrangmentSnapshot(snapshot, file);
+	}, TakeArrangmentSnapshot(arr), path);
+}
+
+std::future<bool> SaveArrangmentAsync(Arrangement_2D& arr, Face_Geometry_Cache& cache, String path)
+{
+	return std::async(std::launch::async, [](Arrangement_Snapshot snapshot, String file)
+	{
+		return WriteArrangmentSnapshot(snapshot, file);
+	}, TakeArrangmentSnapshot(arr, cache), path);
+}
+
+bool LoadArrangment(String path, Arrangement_2D& arr)
+{
+	Record_Batch_Queue queue;
+
+	// The reader thread parses the file ahead, while this thread builds the arrangment from the batches already parsed.
+	std::thread reader(ReadArrangmentRecords, path, std::ref(queue));
+
+	// An edge listed by the faces appears once per incident face (in both directions); it is kept only the first time.
+	std::set<std::array<double, 4>> keptSegments;
+	std::set<std::array<double, 2>> endPoints;
+	std::vector<std::array<double, 2>> vertices;
+	std::vector<Arr_Curve_2D> segments;
+	Arrangement_2D loadedArr;
+	Record_Batch batch;
+	try
+	{
+		while (queue.Pop(batch))
+		{
+			for (size_t i = 0; i < batch.size(); i++)
+			{
+				const Arrangement_Record& record = batch[i];
+				if (record.isVertex)
+				{
+					vertices.push_back({ record.x1, record.y1 });
+					continue;
+				}
+				CGAL::Comparison_result order = CompareXY(record.x1, record.y1, record.x2, record.y2);
+				if (order == CGAL::EQUAL)
+				{
+					continue;
+				}
+				std::array<double, 4> key = { record.x1, record.y1, record.x2, record.y2 };
+				if (order == CGAL::LARGER)
+				{
+					key = { record.x2, record.y2, record.x1, record.y1 };
+				}
+				if (!keptSegments.insert(key).second)
+				{
+					continue;
+				}
+				endPoints.insert({ key[0], key[1] });
+				endPoints.insert({ key[2], key[3] });
+				segments.push_back(Arr_Curve_2D(Point_2D(record.x1, record.y1), Point_2D(record.x2, record.y2)));
+			}
+
+			// An aggregated insert sweeps over the edges already built too: waiting until the pending segments are as many
+			// keeps the total cost of the sweeps at O(n log n), while the reader goes on filling the queue.
+			if (segments.size() >= std::max(Records_Per_Batch, loadedArr.number_of_edges()))
+			{
+				insert(loadedArr, segments.begin(), segments.end());
+				segments.clear();
+			}
+		}
+		insert(loadedArr, segments.begin(), segments.end());
+	}
+	catch (...)
+	{
+		// Let the reader run to completion before giving up, so it is never left blocked on a full queue.
+		while (queue.Pop(batch))
+		{
+		}
+		reader.join();
+		throw;
+	}
+	reader.join();
+	if (!queue.Succeeded())
+	{
+		return false;
+	}
+
+	// Every other vertex is an end point of a written edge and was created by the sweeps.
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		if (endPoints.find(vertices[i]) == endPoints.end())
+		{
+			insert_point(loadedArr, Point_2D(vertices[i][0], vertices[i][1]));
+		}
+	}
+	arr = loadedArr;
+	return true;
+}
+
+std::future<bool> LoadArrangmentAsync(String path, Arrangement_2D& arr)
+{
+	return std::async(std::launch::async, [path, &arr]()
+	{
+		return LoadArrangment(path, arr);
+	});
+}
+
+bool CheckArrangmentRoundTrip(const Arrangement_2D& arr, String path)
+{
+	if (!WriteArrangmentSnapshot(TakeArrangmentSnapshot(arr), path))
+	{
+		std::cout << "Unable to write '" << path << "'." << std::endl;
+		return false;
+	}
+	Arrangement_2D loadedArr;
+	if (!LoadArrangment(path, loadedArr))
+	{
+		std::cout << "Unable to read '" << path << "'." << std::endl;
+		return false;
+	}
+	std::cout << "Vertices : " << arr.number_of_vertices() << " -> " << loadedArr.number_of_vertices()
+		<< ",  Edges : " << arr.number_of_edges() << " -> " << loadedArr.number_of_edges()
+		<< ",  Faces : " << arr.number_of_faces() << " -> " << loadedArr.number_of_faces() << std::endl;
+	return loadedArr.number_of_vertices() == arr.number_of_vertices() && loadedArr.number_of_edges() == arr.number_of_edges()
+		&& loadedArr.number_of_faces() == arr.number_of_faces();
+}
@@ -0,0 +1,92 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+#ifndef ARRANGEMENT_IO_H
+#define ARRANGEMENT_IO_H
+
+// Linker to Point Location Header File (Kernel, Arrangement and handle typedefs)
+#include "PointLocation.h"
+
+// Face geometry cache, used to take snapshots without walking the CCBs again
+#include "FaceCache.h"
+
+// --------------------------------------------------------------------
+
+/*
+* A consistent, self - contained copy of an arrangement: the vertex coordinates, the end points of every edge (once,
+* whichever faces it bounds: the edges of holes, of trees inside a face and of the unbounded face included) and, for
+* every face, its unbounded flag and the sources of the half-edges of its outer CCB. All the coordinates are the double
+* values that the lazy exact numbers print as, so a snapshot can be serialized on any thread while the arrangement keeps
+* changing. Edge i is edges[4i .. 4i+4) = (x1, y1, x2, y2); the boundary of face i is
+* faceCoordinates[faceOffsets[i] .. faceOffsets[i+1]) = (x0, y0, x1, y1, ...).
+*/
+struct Arrangement_Snapshot
+{
+	std::vector<double> vertices;
+	std::vector<double> edges;
+	std::vector<double> faceCoordinates;
+	std::vector<size_t> faceOffsets;
+	std::vector<char> faceUnbounded;
+};
+
+/*
+* This function is responsible for copying the vertices, the edges and the outer boundaries of the faces of the given
+* arrangment into a snapshot. It runs on the calling thread and performs no I/O.
+*/
+Arrangement_Snapshot TakeArrangmentSnapshot(const Arrangement_2D& arr);
+
+/*
+* This function is responsible for taking a snapshot of the given arrangment, reading the face boundaries from the
+* given face cache (which must be attached to arr), so faces that were already cached are not walked again.
+*/
+Arrangement_Snapshot TakeArrangmentSnapshot(Arrangement_2D& arr, Face_Geometry_Cache& cache);
+
+/*
+* This function is responsible for writting the given snapshot to the file provided by the given path, with enough digits
+* for every coordinate to be read back as the same double: the vertices, a separator, the line "Edges" followed by the two
+* end points of every edge, a separator, then the faces in the format of SaveArrangment (which LoadArrangment does not
+* need to rebuild the arrangment, and skips). The data is first written
+* to "<path>.tmp", which is then renamed over path, so on POSIX systems readers of path always see either the previous
+* or the new checkpoint, never a partial one (on Windows the old file is removed before the rename, which is not atomic). Returns true on success.
+*/
+bool WriteArrangmentSnapshot(const Arrangement_Snapshot& snapshot, String path);
+
+/*
+* This function is responsible for checkpointing the given arrangment to the file provided by the given path without
+* blocking the caller on I/O. The snapshot is taken on the calling thread before the function returns; serialization
+* and the atomic rename run on a background thread. The returned future becomes ready once the file is in place.
+*/
+std::future<bool> SaveArrangmentAsync(const Arrangement_2D& arr, String path);
+
+/*
+* Same as above, taking the face boundaries from the given face cache.
+*/
+std::future<bool> SaveArrangmentAsync(Arrangement_2D& arr, Face_Geometry_Cache& cache, String path);
+
+/*
+* This function is responsible for reading a file written by WriteArrangmentSnapshot (or SaveArrangmentAsync) and storing
+* its corresponding arrangment in arr (replacing its contents). A background thread reads and parses the file ahead, in
+* batches, while the calling thread inserts the segments already parsed: every time the pending segments are as many as
+* the edges built so far, they are inserted with one aggregated insert, so the reconstruction overlaps the reading and
+* costs O(n log n) sweeps overall. The isolated vertices are inserted last. Files written by SaveArrangment, which list the
+* edges of the faces instead (once per incident face, so duplicates are dropped), are read as well. Returns false, leaving
+* arr unchanged, if the file cannot be opened or read, or contains a line that is not a coordinate pair.
+* Example: Arrangement_2D arr; if (!LoadArrangment("arrangment.txt", arr)) { ... }
+*/
+bool LoadArrangment(String path, Arrangement_2D& arr);
+
+/*
+* This function is responsible for loading the arrangment of the file provided by the given path (as
+* LoadArrangment(path, arr)) on a background thread. arr must not be used until the returned future is ready; the
+* future holds the result of LoadArrangment.
+*/
+std::future<bool> LoadArrangmentAsync(String path, Arrangement_2D& arr);
+
+/*
+* This function is responsible for checking that the given arrangment survives a round trip through the file provided by
+* the given path: it is written with WriteArrangmentSnapshot, read back with LoadArrangment, and the numbers of vertices,
+* edges and faces are compared. Returns false, and displays the counts, if the file cannot be written or read or if any
+* count differs.
+*/
+bool CheckArrangmentRoundTrip(const Arrangement_2D& arr, String path);
+#endif
@@ -0,0 +1,252 @@
+// Linker to Header File
+#include "FaceCache.h"
+
+// Snapshots and their atomic, full precision writer
+#include "ArrangementIO.h"
+
+Face_Geometry_Cache::Face_Geometry_Cache(Arrangement_2D& arr) : Arrangement_Observer(arr), hits(0), misses(0)
+{
+}
+
+const Face_Geometry& Face_Geometry_Cache::Get(Face_handle f)
+{
+	// unordered_map::find
+	// Searches the container for an element with the given key and returns an iterator to it if found.
+	// https://www.cplusplus.com/reference/unordered_map/unordered_map/find/
+	auto entry = faces.find(&(*f));
+	if (entry != faces.end())
+	{
+		hits++;
+		return entry->second;
+	}
+	misses++;
+	return faces.emplace(&(*f), ComputeFaceGeometry(f)).first->second;
+}
+
+void Face_Geometry_Cache::Invalidate(Face_handle f)
+{
+	faces.erase(&(*f));
+}
+
+void Face_Geometry_Cache::Clear()
+{
+	faces.clear();
+}
+
+size_t Face_Geometry_Cache::Size() const
+{
+	return faces.size();
+}
+
+size_t Face_Geometry_Cache::Hits() const
+{
+	return hits;
+}
+
+size_t Face_Geometry_Cache::Misses() const
+{
+	return misses;
+}
+
+void Face_Geometry_Cache::InvalidateIncidentFaces(Arrangement_2D::Halfedge_handle e)
+{
+	faces.erase(&(*e->face()));
+	faces.erase(&(*e->twin()->face()));
+}
+
+void Face_Geometry_Cache::after_attach()
+{
+	Clear();
+}
+
+void Face_Geometry_Cache::before_detach()
+{
+	Clear();
+}
+
+void Face_Geometry_Cache::after_assign()
+{
+	Clear();
+}
+
+void Face_Geometry_Cache::after_clear()
+{
+	Clear();
+}
+
+void Face_Geometry_Cache::after_global_change()
+{
+	Clear();
+}
+
+void Face_Geometry_Cache::after_create_edge(Arrangement_2D::Halfedge_handle e)
+{
+	InvalidateIncidentFaces(e);
+}
+
+void Face_Geometry_Cache::before_modify_edge(Arrangement_2D::Halfedge_handle e, const Arr_Curve_2D& c)
+{
+	InvalidateIncidentFaces(e);
+}
+
+void Face_Geometry_Cache::before_modify_vertex(Arrangement_2D::Vertex_handle v, const Point_2D& p)
+{
+	// A moved vertex changes the boundary of every face around it.
+	before_remove_vertex(v);
+}
+
+void Face_Geometry_Cache::after_split_edge(Arrangement_2D::Halfedge_handle e1, Arrangement_2D::Halfedge_handle e2)
+{
+	InvalidateIncidentFaces(e1);
+	InvalidateIncidentFaces(e2);
+}
+
+void Face_Geometry_Cache::before_merge_edge(Arrangement_2D::Halfedge_handle e1, Arrangement_2D::Halfedge_handle e2, const Arr_Curve_2D& c)
+{
+	InvalidateIncidentFaces(e1);
+	InvalidateIncidentFaces(e2);
+}
+
+void Face_Geometry_Cache::after_split_face(Arrangement_2D::Face_handle f, Arrangement_2D::Face_handle new_f, bool is_hole)
+{
+	faces.erase(&(*f));
+	faces.erase(&(*new_f));
+}
+
+void Face_Geometry_Cache::before_merge_face(Arrangement_2D::Face_handle f1, Arrangement_2D::Face_handle f2, Arrangement_2D::Halfedge_handle e)
+{
+	// f2 is deleted by the merge, so its address may be reused by a face created later on.
+	faces.erase(&(*f1));
+	faces.erase(&(*f2));
+}
+
+void Face_Geometry_Cache::before_move_outer_ccb(Arrangement_2D::Face_handle from_f, Arrangement_2D::Face_handle to_f, Arrangement_2D::Ccb_halfedge_circulator h)
+{
+	faces.erase(&(*from_f));
+	faces.erase(&(*to_f));
+}
+
+void Face_Geometry_Cache::before_remove_edge(Arrangement_2D::Halfedge_handle e)
+{
+	InvalidateIncidentFaces(e);
+}
+
+void Face_Geometry_Cache::before_remove_vertex(Arrangement_2D::Vertex_handle v)
+{
+	if (v->is_isolated())
+	{
+		return;
+	}
+	Arrangement_2D::Halfedge_around_vertex_circulator circulator = v->incident_halfedges();
+	Arrangement_2D::Halfedge_around_vertex_circulator indexcirculator = circulator;
+	do
+	{
+		InvalidateIncidentFaces(indexcirculator);
+		indexcirculator++;
+	} while (indexcirculator != circulator);
+}
+
+Face_Geometry ComputeFaceGeometry(Face_handle f)
+{
+	Face_Geometry geometry;
+	geometry.unbounded = f->is_unbounded();
+	geometry.area = 0;
+	geometry.centroidX = 0;
+	geometry.centroidY = 0;
+	if (geometry.unbounded)
+	{
+		return geometry;
+	}
+
+	HalfEdge_circulator circulator = f->outer_ccb();
+	HalfEdge_circulator indexcirculator = circulator;
+	do
+	{
+		// CGAL::to_double
+		// Returns a double approximation of the exact (lazy) coordinate.
+		const Point_2D& source = indexcirculator->source()->point();
+		double x = CGAL::to_double(source.x());
+		double y = CGAL::to_double(source.y());
+		geometry.boundary.push_back(x);
+		geometry.boundary.push_back(y);
+		geometry.bbox += CGAL::Bbox_2(x, y, x, y);
+		indexcirculator++;
+	} while (indexcirculator != circulator);
+
+	// Shoelace formula for the signed area and the area centroid of a simple polygon.
+	// https://en.wikipedia.org/wiki/Centroid#Of_a_polygon
+	size_t n = geometry.boundary.size() / 2;
+	double sumX = 0;
+	double sumY = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		size_t j = (i + 1) % n;
+		double xi = geometry.boundary[2 * i];
+		double yi = geometry.boundary[2 * i + 1];
+		double xj = geometry.boundary[2 * j];
+		double yj = geometry.boundary[2 * j + 1];
+		double cross = xi * yj - xj * yi;
+		geometry.area += cross;
+		geometry.centroidX += (xi + xj) * cross;
+		geometry.centroidY += (yi + yj) * cross;
+		sumX += xi;
+		sumY += yi;
+	}
+	geometry.area /= 2;
+	if (geometry.area != 0)
+	{
+		geometry.centroidX /= (6 * geometry.area);
+		geometry.centroidY /= (6 * geometry.area);
+	}
+	else
+	{
+		// Degenerate (zero area) boundary: fall back to the vertex average.
+		geometry.centroidX = sumX / n;
+		geometry.centroidY = sumY / n;
+	}
+	return geometry;
+}
+
+void DisplayFace(Face_handle f, Face_Geometry_Cache& cache)
+{
+	const Face_Geometry& geometry = cache.Get(f);
+	if (geometry.unbounded)
+	{
+		std::cout << "Unbounded face. " << std::endl;
+	}
+	else
+	{
+		std::cout << "Outer boundary: " << std::endl;
+		size_t n = geometry.boundary.size() / 2;
+		for (size_t i = 0; i < n; i++)
+		{
+			size_t j = (i + 1) % n;
+			std::cout << "vector((" << geometry.boundary[2 * i] << ", " << geometry.boundary[2 * i + 1] << "), ";
+			std::cout << "(" << geometry.boundary[2 * j] << ", " << geometry.boundary[2 * j + 1] << ")) " << std::endl;
+		}
+	}
+}
+
+void displayQueryResult(Point_2D point, Location_Result_Type Point_Location_Result_Object, Face_Geometry_Cache& cache)
+{
+	const Face_handle* f;
+
+	if (f = boost::get<Face_handle>(&Point_Location_Result_Object))
+	{
+		// Located inside a face
+		std::cout << "Point:(" << point.x() << "," << point.y() << ") was located inside a face." << std::endl;
+		std::cout << "Face details:" << std::endl;
+		DisplayFace((*f), cache);
+		std::cout << "-------------------------------------" << std::endl;
+	}
+	else
+	{
+		// Edges and vertices carry no face geometry.
+		displayQueryResult(point, Point_Location_Result_Object);
+	}
+}
+
+bool SaveArrangment(Arrangement_2D& arr, Face_Geometry_Cache& cache, String path)
+{
+	return WriteArrangmentSnapshot(TakeArrangmentSnapshot(arr, cache), path);
+}
@@ -0,0 +1,130 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// CGAL Arrangement Observers
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/index.html#arr_secnotif
+
+#ifndef FACE_CACHE_H
+#define FACE_CACHE_H
+
+// Linker to Point Location Header File (Kernel, Arrangement and handle typedefs)
+#include "PointLocation.h"
+
+// * Unordered maps are associative containers that store elements formed by the combination of a key value and a mapped value.
+// * https://www.cplusplus.com/reference/unordered_map/unordered_map/
+#include <unordered_map>
+
+// --------------------------------------------------------------------
+
+// The class Arr_observer<Arrangement> is the base class for all arrangement observers. An observer is attached to an arrangement
+// and is notified (through virtual functions) before and after every structural change of the arrangement.
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__observer.html
+#include <CGAL/Arr_observer.h>
+
+// A bounding box is a box whose faces are parallel to the axes. Its coordinates are doubles.
+// https://doc.cgal.org/5.0.4/Kernel_23/classCGAL_1_1Bbox__2.html
+#include <CGAL/Bbox_2.h>
+
+// --------------------------------------------------------------------
+
+// Arrangement_Observer :: CGAL::Arr_observer<Arrangement_2D>
+typedef CGAL::Arr_observer<Arrangement_2D> Arrangement_Observer;
+
+/*
+* The cached geometry of the outer boundary of a single face. The boundary is kept as a flat coordinate array
+* holding the source of every half-edge of the outer CCB in traversal order:
+* boundary = (x0, y0, x1, y1, ..., xk, yk)
+* so that the i-th half-edge goes from vertex i to vertex (i+1) mod k. All the values are double approximations
+* of the exact coordinates of the arrangement. Unbounded faces have an empty boundary and zero area.
+*/
+struct Face_Geometry
+{
+	bool unbounded;
+	std::vector<double> boundary;
+	double area;
+	CGAL::Bbox_2 bbox;
+	double centroidX;
+	double centroidY;
+};
+
+/*
+* This class is responsible for caching the outer boundary geometry of the faces of an arrangement. The geometry of a face
+* is built lazily, the first time it is requested, by walking its outer CCB once. Every following request costs a single
+* hash lookup. The cache is an arrangement observer: every structural change that may alter the outer boundary of a face
+* (edge insertion / removal, edge split / merge, face split / merge, global changes) invalidates the affected entries.
+*/
+class Face_Geometry_Cache : public Arrangement_Observer
+{
+public:
+	Face_Geometry_Cache(Arrangement_2D& arr);
+
+	/*
+	* Returns the geometry of the given face, walking its outer CCB only if the face is not cached yet.
+	*/
+	const Face_Geometry& Get(Face_handle f);
+
+	/*
+	* Drops the cached geometry of the given face.
+	*/
+	void Invalidate(Face_handle f);
+
+	/*
+	* Drops every cached face.
+	*/
+	void Clear();
+
+	size_t Size() const;
+	size_t Hits() const;
+	size_t Misses() const;
+
+	// Arrangement_Observer notifications
+	virtual void after_attach();
+	virtual void before_detach();
+	virtual void after_assign();
+	virtual void after_clear();
+	virtual void after_global_change();
+	virtual void after_create_edge(Arrangement_2D::Halfedge_handle e);
+	virtual void before_modify_edge(Arrangement_2D::Halfedge_handle e, const Arr_Curve_2D& c);
+	virtual void before_modify_vertex(Arrangement_2D::Vertex_handle v, const Point_2D& p);
+	virtual void after_split_edge(Arrangement_2D::Halfedge_handle e1, Arrangement_2D::Halfedge_handle e2);
+	virtual void before_merge_edge(Arrangement_2D::Halfedge_handle e1, Arrangement_2D::Halfedge_handle e2, const Arr_Curve_2D& c);
+	virtual void after_split_face(Arrangement_2D::Face_handle f, Arrangement_2D::Face_handle new_f, bool is_hole);
+	virtual void before_merge_face(Arrangement_2D::Face_handle f1, Arrangement_2D::Face_handle f2, Arrangement_2D::Halfedge_handle e);
+	virtual void before_move_outer_ccb(Arrangement_2D::Face_handle from_f, Arrangement_2D::Face_handle to_f, Arrangement_2D::Ccb_halfedge_circulator h);
+	virtual void before_remove_edge(Arrangement_2D::Halfedge_handle e);
+	virtual void before_remove_vertex(Arrangement_2D::Vertex_handle v);
+
+private:
+	void InvalidateIncidentFaces(Arrangement_2D::Halfedge_handle e);
+
+	std::unordered_map<const Arrangement_2D::Face*, Face_Geometry> faces;
+	size_t hits;
+	size_t misses;
+};
+
+/*
+* This function is responsible for computing the outer boundary geometry (flat boundary, area, bounding box and centroid)
+* of the given face, by walking its outer CCB.
+*/
+Face_Geometry ComputeFaceGeometry(Face_handle f);
+
+/*
+* This function is reponsible for displaying to the screen, the half-edge traversal list, of the outter bound of the given face.
+* The boundary is taken from the given face cache, so only the first display of a face walks its CCB.
+*/
+void DisplayFace(Face_handle f, Face_Geometry_Cache& cache);
+
+/*
+* This function is responsible for displaying the result of the query of a point location search, taking the
+* geometry of located faces from the given face cache.
+*/
+void displayQueryResult(Point_2D point, Location_Result_Type Point_Location_Result_Object, Face_Geometry_Cache& cache);
+
+/*
+* This function is responsible for saving the nodes, the edges and the half-edges of every face, of a given arrangment,
+* in the file provided by the given path, through WriteArrangmentSnapshot (atomically, with enough digits for every
+* coordinate to be read back as the same double). The face boundaries are taken from the given face cache, which must be
+* attached to arr. Returns true on success.
+*/
+bool SaveArrangment(Arrangement_2D& arr, Face_Geometry_Cache& cache, String path);
+#endif
@@ -0,0 +1,70 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Static floating - point filters for geometric predicates on double coordinates
+// https://www.cs.cmu.edu/~quake/robust.html
+
+#ifndef FILTERED_PREDICATES_H
+#define FILTERED_PREDICATES_H
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// Predefined Kernel:
+// * Exact Geometric Predicates Inexact Geometric Constructions
+// * It provides exact geometric predicates on double coordinates, and is used here only as the exact
+// * fallback of the static filter below.
+// * https://doc.cgal.org/5.0.4/Kernel_23/classCGAL_1_1Exact__predicates__inexact__constructions__kernel.html
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+// Naming Conventions for simplicity
+// * Double_Kernel : CGAL::Exact_predicates_inexact_constructions_kernel
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Double_Kernel;
+
+// * Double_Point_2D : Double_Kernel::Point_2
+typedef Double_Kernel::Point_2 Double_Point_2D;
+
+// Relative error bound of the orientation determinant evaluated in double precision:
+// (3 + 16 * eps) * eps, with eps = 2^-53 (Shewchuk, "Adaptive Precision Floating-Point Arithmetic", ccwerrboundA).
+const double Orientation_Error_Bound = 3.3306690738754716e-16;
+
+/*
+* This function is responsible for returning the orientation of the points a, b, c given by their double coordinates.
+* The determinant is first evaluated in double precision; only when its magnitude is below the static error bound
+* (nearly collinear points) the exact predicate of Double_Kernel is evaluated. The result is always exact.
+*/
+inline CGAL::Orientation FilteredOrientation(double ax, double ay, double bx, double by, double cx, double cy)
+{
+	double detLeft = (bx - ax) * (cy - ay);
+	double detRight = (by - ay) * (cx - ax);
+	double det = detLeft - detRight;
+	double errorBound = Orientation_Error_Bound * (std::fabs(detLeft) + std::fabs(detRight));
+	if (det > errorBound)
+	{
+		return CGAL::LEFT_TURN;
+	}
+	if (-det > errorBound)
+	{
+		return CGAL::RIGHT_TURN;
+	}
+	return CGAL::orientation(Double_Point_2D(ax, ay), Double_Point_2D(bx, by), Double_Point_2D(cx, cy));
+}
+
+/*
+* This function is responsible for comparing two points given by their double coordinates lexicographically,
+* first by x and then by y coordinate.
+*/
+inline CGAL::Comparison_result CompareXY(double ax, double ay, double bx, double by)
+{
+	if (ax < bx)
+		return CGAL::SMALLER;
+	if (ax > bx)
+		return CGAL::LARGER;
+	if (ay < by)
+		return CGAL::SMALLER;
+	if (ay > by)
+		return CGAL::LARGER;
+	return CGAL::EQUAL;
+}
+#endif
@@ -0,0 +1,469 @@
+// Linker to Header File
+#include "FrozenArrangement.h"
+
+// Chunked parallel loop over the queries
+#include "Parallel.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that defines fixed width integer types (std::uint32_t, std::uint64_t).
+// * https://www.cplusplus.com/reference/cstdint/
+#include <cstdint>
+
+// * Header that declares std::memcpy, used to copy the arrays into and out of the blob.
+// * https://www.cplusplus.com/reference/cstring/memcpy/
+#include <cstring>
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// * Header that describes the characteristics of arithmetic types (infinity).
+// * https://www.cplusplus.com/reference/limits/numeric_limits/
+#include <limits>
+
+namespace
+{
+	// The first bytes of a serialized frozen arrangement.
+	const std::uint32_t Frozen_Magic = 0x315A5246;
+
+	// The orientation of (x, y) with respect to the half-edge h: positive to its left, negative to its right.
+	double Orientation(const Frozen_Arrangement& frozen, int h, double x, double y)
+	{
+		const double* source = &frozen.vertices[2 * frozen.halfEdgeTarget[h ^ 1]];
+		const double* target = &frozen.vertices[2 * frozen.halfEdgeTarget[h]];
+		return (target[0] - source[0]) * (y - source[1]) - (target[1] - source[1]) * (x - source[0]);
+	}
+
+	// The height of the half-edge h at the given x.
+	double HeightAt(const Frozen_Arrangement& frozen, int h, double x)
+	{
+		const double* source = &frozen.vertices[2 * frozen.halfEdgeTarget[h ^ 1]];
+		const double* target = &frozen.vertices[2 * frozen.halfEdgeTarget[h]];
+		return source[1] + (x - source[0]) * (target[1] - source[1]) / (target[0] - source[0]);
+	}
+
+	// The location of a point strictly inside the slab k, or on its left wall but on no vertex and no vertical edge.
+	Frozen_Location LocateInSlab(const Frozen_Arrangement& frozen, size_t k, double x, double y)
+	{
+		const int* first = frozen.slabHalfEdges.data() + frozen.slabOffsets[k];
+		const int* last = frozen.slabHalfEdges.data() + frozen.slabOffsets[k + 1];
+		const int* above = std::partition_point(first, last, [&frozen, x, y](int h) { return Orientation(frozen, h, x, y) > 0; });
+		if (above != last && Orientation(frozen, *above, x, y) == 0)
+		{
+			return Frozen_Location{ FROZEN_EDGE, *above };
+		}
+		return Frozen_Location{ FROZEN_FACE, above == first ? frozen.unboundedFace : frozen.halfEdgeFace[above[-1]] };
+	}
+
+	template <class T>
+	void WriteArray(const std::vector<T>& values, std::vector<char>& blob)
+	{
+		std::uint64_t size = values.size();
+		size_t offset = blob.size();
+		blob.resize(offset + sizeof(size) + size * sizeof(T));
+		std::memcpy(&blob[offset], &size, sizeof(size));
+		if (size > 0)
+		{
+			std::memcpy(&blob[offset + sizeof(size)], values.data(), size * sizeof(T));
+		}
+	}
+
+	template <class T>
+	bool ReadArray(const std::vector<char>& blob, size_t& offset, std::vector<T>& values)
+	{
+		std::uint64_t size;
+		if (blob.size() - offset < sizeof(size))
+		{
+			return false;
+		}
+		std::memcpy(&size, &blob[offset], sizeof(size));
+		offset += sizeof(size);
+		if ((blob.size() - offset) / sizeof(T) < size)
+		{
+			return false;
+		}
+		values.resize((size_t)size);
+		if (size > 0)
+		{
+			std::memcpy(values.data(), &blob[offset], (size_t)size * sizeof(T));
+		}
+		offset += (size_t)size * sizeof(T);
+		return true;
+	}
+
+	// Every value is an index in [min, end).
+	bool IndicesIn(const std::vector<int>& values, int min, size_t end)
+	{
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			if (values[i] < min || values[i] >= (std::int64_t)end)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Offsets of count compressed rows into an array of the given size: count + 1 non decreasing offsets from 0 to size
+	// (strictly increasing if the rows may not be empty).
+	bool RowOffsets(const std::vector<int>& offsets, size_t count, size_t size, bool nonEmptyRows)
+	{
+		if (offsets.size() != count + 1 || offsets.front() != 0 || offsets.back() != (std::int64_t)size)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < count; i++)
+		{
+			if (offsets[i + 1] < offsets[i] + (nonEmptyRows ? 1 : 0))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// The distance from (x, y) to the nearest edge or vertex of the frozen arrangement (infinity if it has none).
+	double DistanceToNearestFeature(const Frozen_Arrangement& frozen, double x, double y)
+	{
+		double nearest = std::numeric_limits<double>::infinity();
+		for (size_t v = 0; v < frozen.vertices.size() / 2; v++)
+		{
+			nearest = std::min(nearest, std::hypot(x - frozen.vertices[2 * v], y - frozen.vertices[2 * v + 1]));
+		}
+		for (size_t h = 0; h < frozen.halfEdgeTarget.size(); h += 2)
+		{
+			const double* source = &frozen.vertices[2 * frozen.halfEdgeTarget[h + 1]];
+			const double* target = &frozen.vertices[2 * frozen.halfEdgeTarget[h]];
+			double dx = target[0] - source[0];
+			double dy = target[1] - source[1];
+			double length2 = dx * dx + dy * dy;
+			double t = length2 > 0 ? std::max(0.0, std::min(1.0, ((x - source[0]) * dx + (y - source[1]) * dy) / length2)) : 0;
+			nearest = std::min(nearest, std::hypot(x - source[0] - t * dx, y - source[1] - t * dy));
+		}
+		return nearest;
+	}
+
+	// The arrays of a deserialized frozen arrangement have consistent sizes and every index they hold is in range, so
+	// that LocateFrozen and the DCEL arrays cannot read out of bounds.
+	bool ValidFrozenArrangment(const Frozen_Arrangement& frozen)
+	{
+		size_t nrOfVertices = frozen.vertices.size() / 2;
+		size_t nrOfHalfEdges = frozen.halfEdgeTarget.size();
+		size_t nrOfFaces = frozen.faceOuterHalfEdge.size();
+		size_t nrOfSlabs = frozen.slabX.size();
+		if (frozen.vertices.size() % 2 != 0 || frozen.vertexHalfEdge.size() != nrOfVertices
+			|| nrOfHalfEdges % 2 != 0 || frozen.halfEdgeNext.size() != nrOfHalfEdges || frozen.halfEdgeFace.size() != nrOfHalfEdges
+			|| frozen.unboundedFace < 0 || frozen.unboundedFace >= (std::int64_t)nrOfFaces
+			|| frozen.columnVertices.size() != nrOfVertices || frozen.columnUpHalfEdge.size() != nrOfVertices)
+		{
+			return false;
+		}
+		for (size_t k = 1; k < nrOfSlabs; k++)
+		{
+			if (!(frozen.slabX[k - 1] < frozen.slabX[k]))
+			{
+				return false;
+			}
+		}
+		return IndicesIn(frozen.vertexHalfEdge, -1, nrOfHalfEdges)
+			&& IndicesIn(frozen.halfEdgeTarget, 0, nrOfVertices)
+			&& IndicesIn(frozen.halfEdgeNext, 0, nrOfHalfEdges)
+			&& IndicesIn(frozen.halfEdgeFace, 0, nrOfFaces)
+			&& IndicesIn(frozen.faceOuterHalfEdge, -1, nrOfHalfEdges)
+			&& RowOffsets(frozen.faceHoleOffsets, nrOfFaces, frozen.faceHoles.size(), false)
+			&& IndicesIn(frozen.faceHoles, 0, nrOfHalfEdges)
+			&& RowOffsets(frozen.slabOffsets, nrOfSlabs, frozen.slabHalfEdges.size(), false)
+			&& IndicesIn(frozen.slabHalfEdges, 0, nrOfHalfEdges)
+			&& RowOffsets(frozen.columnOffsets, nrOfSlabs, frozen.columnVertices.size(), true)
+			&& IndicesIn(frozen.columnVertices, 0, nrOfVertices)
+			&& IndicesIn(frozen.columnUpHalfEdge, -1, nrOfHalfEdges);
+	}
+}
+
+Frozen_Arrangement FreezeArrangment(const Arrangement_2D& arr)
+{
+	Frozen_Arrangement frozen;
+	Arrangement_Index index(arr);
+
+	// The half-edge 2e of every edge e, from its lexicographically smaller end point.
+	std::vector<HalfEdge_handle> forward(index.NumberOfEdges());
+	for (int e = 0; e < forward.size(); e++)
+	{
+		forward[e] = index.Edge(e);
+		if (CGAL::compare_xy(forward[e]->source()->point(), forward[e]->target()->point()) == CGAL::LARGER)
+		{
+			forward[e] = forward[e]->twin();
+		}
+	}
+	auto halfEdgeIndex = [&index, &forward](HalfEdge_handle h)
+	{
+		int e = index.EdgeIndex(h);
+		return h == forward[e] ? 2 * e : 2 * e + 1;
+	};
+
+	frozen.vertices.reserve(2 * index.NumberOfVertices());
+	frozen.vertexHalfEdge.reserve(index.NumberOfVertices());
+	for (int v = 0; v < index.NumberOfVertices(); v++)
+	{
+		Vertex_handle vertex = index.Vertex(v);
+		frozen.vertices.push_back(CGAL::to_double(vertex->point().x()));
+		frozen.vertices.push_back(CGAL::to_double(vertex->point().y()));
+		// Arrangement_2::Vertex::incident_halfedges
+		// Returns a circulator over the half-edges that have the vertex as their target.
+		frozen.vertexHalfEdge.push_back(vertex->is_isolated() ? -1 : halfEdgeIndex(vertex->incident_halfedges()));
+	}
+
+	frozen.halfEdgeTarget.resize(2 * forward.size());
+	frozen.halfEdgeNext.resize(2 * forward.size());
+	frozen.halfEdgeFace.resize(2 * forward.size());
+	for (int h = 0; h < frozen.halfEdgeTarget.size(); h++)
+	{
+		HalfEdge_handle halfEdge = h % 2 == 0 ? forward[h / 2] : forward[h / 2]->twin();
+		frozen.halfEdgeTarget[h] = index.VertexIndex(halfEdge->target());
+		frozen.halfEdgeNext[h] = halfEdgeIndex(halfEdge->next());
+		frozen.halfEdgeFace[h] = index.FaceIndex(halfEdge->face());
+	}
+
+	frozen.unboundedFace = index.FaceIndex(arr.unbounded_face());
+	frozen.faceHoleOffsets.push_back(0);
+	for (int f = 0; f < index.NumberOfFaces(); f++)
+	{
+		Face_handle face = index.Face(f);
+		frozen.faceOuterHalfEdge.push_back(face->is_unbounded() ? -1 : halfEdgeIndex(face->outer_ccb()));
+		// Arrangement_2::Face::inner_ccbs_begin
+		// Iterates over the boundaries of the holes of a face, one half-edge circulator per hole.
+		for (Arrangement_2D::Inner_ccb_const_iterator hole = face->inner_ccbs_begin(); hole != face->inner_ccbs_end(); hole++)
+		{
+			frozen.faceHoles.push_back(halfEdgeIndex(*hole));
+		}
+		frozen.faceHoleOffsets.push_back((int)frozen.faceHoles.size());
+	}
+
+	// The columns: the vertices sorted by x, then y, grouped by x.
+	std::vector<int> order(index.NumberOfVertices());
+	for (int v = 0; v < order.size(); v++)
+	{
+		order[v] = v;
+	}
+	const std::vector<double>& vertices = frozen.vertices;
+	std::sort(order.begin(), order.end(), [&vertices](int a, int b)
+	{
+		return vertices[2 * a] < vertices[2 * b] || (vertices[2 * a] == vertices[2 * b] && vertices[2 * a + 1] < vertices[2 * b + 1]);
+	});
+	std::vector<int> columnPosition(order.size());
+	for (int i = 0; i < order.size(); i++)
+	{
+		if (i == 0 || vertices[2 * order[i]] != frozen.slabX.back())
+		{
+			frozen.slabX.push_back(vertices[2 * order[i]]);
+			frozen.columnOffsets.push_back(i);
+		}
+		frozen.columnVertices.push_back(order[i]);
+		columnPosition[order[i]] = i;
+	}
+	frozen.columnOffsets.push_back((int)order.size());
+	frozen.columnUpHalfEdge.assign(order.size(), -1);
+
+	// The slabs, in compressed rows: count the edges crossing every slab, then fill and sort the rows.
+	std::vector<std::pair<size_t, size_t>> spans(forward.size());
+	frozen.slabOffsets.assign(frozen.slabX.size() + 1, 0);
+	for (int e = 0; e < forward.size(); e++)
+	{
+		int source = frozen.halfEdgeTarget[2 * e + 1];
+		int target = frozen.halfEdgeTarget[2 * e];
+		spans[e].first = std::lower_bound(frozen.slabX.begin(), frozen.slabX.end(), vertices[2 * source]) - frozen.slabX.begin();
+		spans[e].second = std::lower_bound(frozen.slabX.begin(), frozen.slabX.end(), vertices[2 * target]) - frozen.slabX.begin();
+		if (spans[e].first == spans[e].second)
+		{
+			// A vertical edge (or one whose end points round to the same x) runs up its column.
+			frozen.columnUpHalfEdge[columnPosition[source]] = 2 * e;
+		}
+		for (size_t k = spans[e].first; k < spans[e].second; k++)
+		{
+			frozen.slabOffsets[k + 1]++;
+		}
+	}
+	for (size_t k = 0; k < frozen.slabX.size(); k++)
+	{
+		frozen.slabOffsets[k + 1] += frozen.slabOffsets[k];
+	}
+	frozen.slabHalfEdges.resize(frozen.slabOffsets.back());
+	std::vector<int> fill(frozen.slabOffsets.begin(), frozen.slabOffsets.end() - 1);
+	for (int e = 0; e < forward.size(); e++)
+	{
+		for (size_t k = spans[e].first; k < spans[e].second; k++)
+		{
+			frozen.slabHalfEdges[fill[k]++] = 2 * e;
+		}
+	}
+	for (size_t k = 0; k + 1 < frozen.slabX.size(); k++)
+	{
+		// Edges do not cross inside a slab, so their order is the order of their heights at its middle.
+		double middle = (frozen.slabX[k] + frozen.slabX[k + 1]) / 2;
+		std::sort(frozen.slabHalfEdges.begin() + frozen.slabOffsets[k], frozen.slabHalfEdges.begin() + frozen.slabOffsets[k + 1], [&frozen, middle](int a, int b)
+		{
+			return HeightAt(frozen, a, middle) < HeightAt(frozen, b, middle);
+		});
+	}
+	return frozen;
+}
+
+double FrozenRoundingDistance(const Frozen_Arrangement& frozen)
+{
+	double largest = 0;
+	for (size_t i = 0; i < frozen.vertices.size(); i++)
+	{
+		largest = std::max(largest, std::abs(frozen.vertices[i]));
+	}
+	return 1e-9 * (1 + largest);
+}
+
+Frozen_Location LocateFrozen(const Frozen_Arrangement& frozen, double x, double y)
+{
+	size_t k = std::lower_bound(frozen.slabX.begin(), frozen.slabX.end(), x) - frozen.slabX.begin();
+	if (k < frozen.slabX.size() && frozen.slabX[k] == x)
+	{
+		// On the wall of a column: a vertex of the column, a vertical edge between two of them, or the slab to the right.
+		const int* first = frozen.columnVertices.data() + frozen.columnOffsets[k];
+		const int* last = frozen.columnVertices.data() + frozen.columnOffsets[k + 1];
+		const int* above = std::partition_point(first, last, [&frozen, y](int v) { return frozen.vertices[2 * v + 1] < y; });
+		if (above != last && frozen.vertices[2 * *above + 1] == y)
+		{
+			return Frozen_Location{ FROZEN_VERTEX, *above };
+		}
+		if (above != first && frozen.columnUpHalfEdge[above - 1 - frozen.columnVertices.data()] != -1)
+		{
+			return Frozen_Location{ FROZEN_EDGE, frozen.columnUpHalfEdge[above - 1 - frozen.columnVertices.data()] };
+		}
+		return LocateInSlab(frozen, k, x, y);
+	}
+	if (k == 0 || k == frozen.slabX.size())
+	{
+		return Frozen_Location{ FROZEN_FACE, frozen.unboundedFace };
+	}
+	return LocateInSlab(frozen, k - 1, x, y);
+}
+
+std::vector<Frozen_Location> LocateFrozenParallel(const Frozen_Arrangement& frozen, const std::vector<double>& points, unsigned int nrOfThreads)
+{
+	std::vector<Frozen_Location> locations(points.size() / 2);
+	ParallelFor(locations.size(), [&](size_t begin, size_t end, unsigned int)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			locations[i] = LocateFrozen(frozen, points[2 * i], points[2 * i + 1]);
+		}
+	}, nrOfThreads);
+	return locations;
+}
+
+std::vector<char> SerializeFrozenArrangment(const Frozen_Arrangement& frozen)
+{
+	std::vector<char> blob(sizeof(Frozen_Magic) + sizeof(frozen.unboundedFace));
+	std::memcpy(&blob[0], &Frozen_Magic, sizeof(Frozen_Magic));
+	std::memcpy(&blob[sizeof(Frozen_Magic)], &frozen.unboundedFace, sizeof(frozen.unboundedFace));
+	WriteArray(frozen.vertices, blob);
+	WriteArray(frozen.vertexHalfEdge, blob);
+	WriteArray(frozen.halfEdgeTarget, blob);
+	WriteArray(frozen.halfEdgeNext, blob);
+	WriteArray(frozen.halfEdgeFace, blob);
+	WriteArray(frozen.faceOuterHalfEdge, blob);
+	WriteArray(frozen.faceHoleOffsets, blob);
+	WriteArray(frozen.faceHoles, blob);
+	WriteArray(frozen.slabX, blob);
+	WriteArray(frozen.slabOffsets, blob);
+	WriteArray(frozen.slabHalfEdges, blob);
+	WriteArray(frozen.columnOffsets, blob);
+	WriteArray(frozen.columnVertices, blob);
+	WriteArray(frozen.columnUpHalfEdge, blob);
+	return blob;
+}
+
+bool DeserializeFrozenArrangment(const std::vector<char>& blob, Frozen_Arrangement& frozen)
+{
+	std::uint32_t magic;
+	size_t offset = sizeof(magic) + sizeof(frozen.unboundedFace);
+	if (blob.size() < offset)
+	{
+		return false;
+	}
+	std::memcpy(&magic, &blob[0], sizeof(magic));
+	std::memcpy(&frozen.unboundedFace, &blob[sizeof(magic)], sizeof(frozen.unboundedFace));
+	return magic == Frozen_Magic
+		&& ReadArray(blob, offset, frozen.vertices)
+		&& ReadArray(blob, offset, frozen.vertexHalfEdge)
+		&& ReadArray(blob, offset, frozen.halfEdgeTarget)
+		&& ReadArray(blob, offset, frozen.halfEdgeNext)
+		&& ReadArray(blob, offset, frozen.halfEdgeFace)
+		&& ReadArray(blob, offset, frozen.faceOuterHalfEdge)
+		&& ReadArray(blob, offset, frozen.faceHoleOffsets)
+		&& ReadArray(blob, offset, frozen.faceHoles)
+		&& ReadArray(blob, offset, frozen.slabX)
+		&& ReadArray(blob, offset, frozen.slabOffsets)
+		&& ReadArray(blob, offset, frozen.slabHalfEdges)
+		&& ReadArray(blob, offset, frozen.columnOffsets)
+		&& ReadArray(blob, offset, frozen.columnVertices)
+		&& ReadArray(blob, offset, frozen.columnUpHalfEdge)
+		&& offset == blob.size()
+		&& ValidFrozenArrangment(frozen);
+}
+
+bool CrossCheckFrozenArrangment(const Arrangement_2D& arr, const Vector_Point_2D& points, int nrOfRandomPoints, unsigned int seed)
+{
+	Frozen_Arrangement frozen;
+	if (!DeserializeFrozenArrangment(SerializeFrozenArrangment(FreezeArrangment(arr)), frozen))
+	{
+		std::cout << "The serialized frozen arrangment does not read back" << std::endl;
+		return false;
+	}
+	Frozen_Arrangement corrupt = frozen;
+	corrupt.unboundedFace = (int)corrupt.faceOuterHalfEdge.size();
+	if (DeserializeFrozenArrangment(SerializeFrozenArrangment(corrupt), corrupt))
+	{
+		std::cout << "A frozen arrangment with a face index out of range reads back" << std::endl;
+		return false;
+	}
+
+	Vector_Point_2D queries = points;
+	if (arr.number_of_vertices() > 0)
+	{
+		CGAL::Bbox_2 box = arr.vertices_begin()->point().bbox();
+		for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+		{
+			box = box + v->point().bbox();
+		}
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<double> x(box.xmin(), box.xmax());
+		std::uniform_real_distribution<double> y(box.ymin(), box.ymax());
+		for (int i = 0; i < nrOfRandomPoints; i++)
+		{
+			queries.push_back(Point_2D(x(generator), y(generator)));
+		}
+	}
+
+	Arrangement_Index index(arr);
+	Naive_Point_Location naive_pl(arr);
+	double roundingDistance = FrozenRoundingDistance(frozen);
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		double px = CGAL::to_double(queries[i].x());
+		double py = CGAL::to_double(queries[i].y());
+		Vertical_Ray_Hit expected = MakeVerticalRayHit(index, naive_pl.locate(queries[i]));
+		Frozen_Location found = LocateFrozen(frozen, px, py);
+		bool same = expected.face != -1 ? found.feature == FROZEN_FACE && found.index == expected.face
+			: expected.edge != -1 ? found.feature == FROZEN_EDGE && found.index / 2 == expected.edge
+			: found.feature == FROZEN_VERTEX && found.index == expected.vertex;
+		if (!same && DistanceToNearestFeature(frozen, px, py) > roundingDistance)
+		{
+			const char* features[3] = { "face", "half-edge", "vertex" };
+			std::cout << "The frozen arrangment locates the point " << i << " (" << px << ", " << py << ") on "
+				<< features[found.feature] << " " << found.index << ", CGAL on vertex " << expected.vertex
+				<< ", edge " << expected.edge << ", face " << expected.face << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
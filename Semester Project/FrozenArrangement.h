@@ -0,0 +1,114 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// A read - only, pointer - free copy of an arrangement for concurrent queries: the doubly connected edge list in flat
+// index arrays, with a slab search structure in compressed rows.
+
+#ifndef FROZEN_ARRANGEMENT_H
+#define FROZEN_ARRANGEMENT_H
+
+// Linker to Vertical Decomposition Header File (Arrangement_Index)
+#include "VerticalDecomposition.h"
+
+// --------------------------------------------------------------------
+
+/*
+* A frozen arrangement: plain arrays of ints and doubles, no handle, no pointer and no lazy number, so any number of
+* threads may query it at the same time without locks, and it can be copied, moved or serialized as one blob.
+* Vertices, faces and edges are numbered as in an Arrangement_Index of the source arrangement; edge e has the half-edges
+* 2e and 2e+1 (the twin of half-edge h is h ^ 1, its source the target of h ^ 1), and half-edge 2e runs from the
+* lexicographically smaller end point to the larger one. The coordinates are double approximations.
+* vertices: (x, y) of vertex v at [2v, 2v+1]; vertexHalfEdge: a half-edge with target v (-1 for an isolated vertex).
+* halfEdgeTarget, halfEdgeNext and halfEdgeFace: the DCEL of the half-edges (the face lies to the left of a half-edge).
+* faceOuterHalfEdge: a half-edge of the outer boundary of face f (-1 for the unbounded face); faceHoles: one half-edge of
+* every hole of face f, at [faceHoleOffsets[f], faceHoleOffsets[f+1]).
+* slabX: the distinct x coordinates of the vertices, increasing. Slab k lies between slabX[k] and slabX[k+1] and is
+* crossed by the half-edges slabHalfEdges[slabOffsets[k] .. slabOffsets[k+1]), from bottom to top (the left to right
+* ones, so the face above each is its face). The vertices on the line x = slabX[k] are
+* columnVertices[columnOffsets[k] .. columnOffsets[k+1]), from bottom to top, and columnUpHalfEdge holds the vertical
+* half-edge going up from each of them (-1 if none).
+* The slabs hold O(n^2) half-edges in the worst case, every edge crossing every slab.
+*/
+struct Frozen_Arrangement
+{
+	std::vector<double> vertices;
+	std::vector<int> vertexHalfEdge;
+	std::vector<int> halfEdgeTarget;
+	std::vector<int> halfEdgeNext;
+	std::vector<int> halfEdgeFace;
+	std::vector<int> faceOuterHalfEdge;
+	std::vector<int> faceHoleOffsets;
+	std::vector<int> faceHoles;
+	int unboundedFace;
+	std::vector<double> slabX;
+	std::vector<int> slabOffsets;
+	std::vector<int> slabHalfEdges;
+	std::vector<int> columnOffsets;
+	std::vector<int> columnVertices;
+	std::vector<int> columnUpHalfEdge;
+};
+
+/*
+* The kind of feature a point was located on.
+*/
+enum Frozen_Feature
+{
+	FROZEN_FACE,
+	FROZEN_EDGE,
+	FROZEN_VERTEX
+};
+
+/*
+* The result of a query: a face, a half-edge (the one running from left to right, or up for a vertical edge) or a vertex.
+*/
+struct Frozen_Location
+{
+	Frozen_Feature feature;
+	int index;
+};
+
+/*
+* This function is responsible for freezing the given arrangment (see Frozen_Arrangement). It runs in
+* O(n log n + s) time, where s is the size of the slabs. The arrangement may change afterwards; the copy does not.
+*/
+Frozen_Arrangement FreezeArrangment(const Arrangement_2D& arr);
+
+/*
+* This function is responsible for returning the rounding distance of the frozen arrangement: 1e-9 times (1 + the
+* largest magnitude of its coordinates). The coordinates are rounded to doubles and the predicates evaluated in doubles,
+* so a point within that distance of an edge or a vertex may be located on a neighbouring feature.
+*/
+double FrozenRoundingDistance(const Frozen_Arrangement& frozen);
+
+/*
+* This function is responsible for locating the given point in the frozen arrangement, in O(log n) time: a binary search
+* for the slab, then for the half-edges below the point. Degenerate cases are decided with double predicates on the
+* approximated coordinates, so a point within FrozenRoundingDistance of an edge or a vertex may be reported on a
+* neighbouring feature.
+*/
+Frozen_Location LocateFrozen(const Frozen_Arrangement& frozen, double x, double y);
+
+/*
+* This function is responsible for locating the given points, (x, y) of point i at [2i, 2i+1], in the frozen
+* arrangement on the given number of threads (0 for all hardware threads), without locks.
+*/
+std::vector<Frozen_Location> LocateFrozenParallel(const Frozen_Arrangement& frozen, const std::vector<double>& points, unsigned int nrOfThreads = 0);
+
+/*
+* This function is responsible for writing the frozen arrangement into one contiguous blob (its arrays, each preceded by
+* its length, in native byte order) and for reading it back; reading returns false if the blob is not a frozen
+* arrangement: a wrong frame, array sizes that do not match each other, an index out of range, offsets that decrease or
+* do not end at the size of their array, or slab walls that do not increase.
+*/
+std::vector<char> SerializeFrozenArrangment(const Frozen_Arrangement& frozen);
+bool DeserializeFrozenArrangment(const std::vector<char>& blob, Frozen_Arrangement& frozen);
+
+/*
+* This function is responsible for cross checking the frozen copy of the given arrangment against CGAL point location on
+* the given points and on nrOfRandomPoints points drawn with the given seed over the bounding box of its vertices. The
+* copy goes through a serialization round trip first, and a copy with an index out of range must be rejected. A point
+* may be located differently only within FrozenRoundingDistance of an edge or a vertex. Returns false, and displays the
+* first mismatch, if they ever differ.
+*/
+bool CrossCheckFrozenArrangment(const Arrangement_2D& arr, const Vector_Point_2D& points, int nrOfRandomPoints, unsigned int seed);
+#endif
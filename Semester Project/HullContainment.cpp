@@ -0,0 +1,227 @@
+// Linker to Header File
+#include "HullContainment.h"
+
+namespace
+{
+	// Orientation and lexicographic comparison of a double query point against the hull vertices.
+	struct Double_Query
+	{
+		const std::vector<double>& xs;
+		const std::vector<double>& ys;
+		double x;
+		double y;
+
+		CGAL::Orientation Orientation(size_t i, size_t j) const
+		{
+			return FilteredOrientation(xs[i], ys[i], xs[j], ys[j], x, y);
+		}
+
+		CGAL::Comparison_result Compare(size_t i) const
+		{
+			return CompareXY(xs[i], ys[i], x, y);
+		}
+	};
+
+	// Orientation and lexicographic comparison of an exact query point against the hull vertices.
+	struct Exact_Query
+	{
+		const Vector_Point_2D& hull;
+		const Point_2D& point;
+
+		CGAL::Orientation Orientation(size_t i, size_t j) const
+		{
+			return CGAL::orientation(hull[i], hull[j], point);
+		}
+
+		CGAL::Comparison_result Compare(size_t i) const
+		{
+			return CGAL::compare_xy(hull[i], point);
+		}
+	};
+
+	// The query point q is collinear with the hull vertices i and j: it lies on the segment (i, j) if and only if it
+	// lies between them in lexicographic order.
+	template <class Query>
+	CGAL::Bounded_side OnSegment(const Query& query, size_t i, size_t j)
+	{
+		CGAL::Comparison_result first = query.Compare(i);
+		CGAL::Comparison_result second = query.Compare(j);
+		return (first == CGAL::EQUAL || second == CGAL::EQUAL || first != second) ? CGAL::ON_BOUNDARY : CGAL::ON_UNBOUNDED_SIDE;
+	}
+
+	template <class Query>
+	CGAL::Bounded_side LocateInConvexPolygon(const Query& query, size_t h)
+	{
+		if (h == 0)
+		{
+			return CGAL::ON_UNBOUNDED_SIDE;
+		}
+		if (h == 1)
+		{
+			return query.Compare(0) == CGAL::EQUAL ? CGAL::ON_BOUNDARY : CGAL::ON_UNBOUNDED_SIDE;
+		}
+		if (h == 2)
+		{
+			return query.Orientation(0, 1) == CGAL::COLLINEAR ? OnSegment(query, 0, 1) : CGAL::ON_UNBOUNDED_SIDE;
+		}
+
+		// q must lie inside the angle (p1, p0, ph-1) of the fan.
+		CGAL::Orientation first = query.Orientation(0, 1);
+		if (first == CGAL::RIGHT_TURN)
+		{
+			return CGAL::ON_UNBOUNDED_SIDE;
+		}
+		if (first == CGAL::COLLINEAR)
+		{
+			return OnSegment(query, 0, 1);
+		}
+		CGAL::Orientation last = query.Orientation(0, h - 1);
+		if (last == CGAL::LEFT_TURN)
+		{
+			return CGAL::ON_UNBOUNDED_SIDE;
+		}
+		if (last == CGAL::COLLINEAR)
+		{
+			return OnSegment(query, 0, h - 1);
+		}
+
+		// Binary search for the wedge (p0, p_low, p_low+1) containing q.
+		// Invariant: q is to the left of (or on) the ray p0 -> p_low and to the right of the ray p0 -> p_high.
+		size_t low = 1;
+		size_t high = h - 1;
+		while (high - low > 1)
+		{
+			size_t middle = low + (high - low) / 2;
+			if (query.Orientation(0, middle) == CGAL::RIGHT_TURN)
+			{
+				high = middle;
+			}
+			else
+			{
+				low = middle;
+			}
+		}
+
+		switch (query.Orientation(low, high))
+		{
+		case CGAL::LEFT_TURN:
+			return CGAL::ON_BOUNDED_SIDE;
+		case CGAL::COLLINEAR:
+			return CGAL::ON_BOUNDARY;
+		default:
+			return CGAL::ON_UNBOUNDED_SIDE;
+		}
+	}
+
+	// Returns true if both coordinates of the given point are exactly double numbers.
+	bool HasDoubleCoordinates(const Point_2D& point, double& x, double& y)
+	{
+		// CGAL::to_interval
+		// Returns the interval approximation of a number; it is a single double if and only if the number is a double.
+		// https://doc.cgal.org/5.0.4/Algebraic_foundations/group__PkgAlgebraicFoundationsRef.html
+		std::pair<double, double> intervalX = CGAL::to_interval(point.x());
+		std::pair<double, double> intervalY = CGAL::to_interval(point.y());
+		x = intervalX.first;
+		y = intervalY.first;
+		return intervalX.first == intervalX.second && intervalY.first == intervalY.second;
+	}
+}
+
+Convex_Hull_Index::Convex_Hull_Index(const Vector_Point_2D& convexHull) : hull(convexHull), doubleHull(true)
+{
+	xs.reserve(hull.size());
+	ys.reserve(hull.size());
+	for (size_t i = 0; i < hull.size(); i++)
+	{
+		double x;
+		double y;
+		doubleHull = HasDoubleCoordinates(hull[i], x, y) && doubleHull;
+		xs.push_back(x);
+		ys.push_back(y);
+	}
+	if (!doubleHull)
+	{
+		// Evaluate the exact coordinates once, so that concurrent queries only read them.
+		for (size_t i = 0; i < hull.size(); i++)
+		{
+			CGAL::exact(hull[i]);
+		}
+	}
+}
+
+CGAL::Bounded_side Convex_Hull_Index::Locate(double x, double y) const
+{
+	if (!doubleHull)
+	{
+		Point_2D point(x, y);
+		Exact_Query query = { hull, point };
+		return LocateInConvexPolygon(query, hull.size());
+	}
+	Double_Query query = { xs, ys, x, y };
+	return LocateInConvexPolygon(query, xs.size());
+}
+
+CGAL::Bounded_side Convex_Hull_Index::Locate(const Point_2D& point) const
+{
+	double x;
+	double y;
+	if (HasDoubleCoordinates(point, x, y))
+	{
+		return Locate(x, y);
+	}
+	Exact_Query query = { hull, point };
+	return LocateInConvexPolygon(query, hull.size());
+}
+
+Vector_Bounded_Side Convex_Hull_Index::BatchLocate(const std::vector<double>& coordinates, unsigned int nrOfThreads) const
+{
+	Vector_Bounded_Side result(coordinates.size() / 2);
+	// A hull without double coordinates is queried with exact predicates, which update its shared lazy numbers: one thread.
+	ParallelFor(result.size(), [&](size_t begin, size_t end, unsigned int)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			result[i] = Locate(coordinates[2 * i], coordinates[2 * i + 1]);
+		}
+	}, doubleHull ? nrOfThreads : 1);
+	return result;
+}
+
+Vector_Bounded_Side Convex_Hull_Index::BatchLocate(const Vector_Point_2D& points, unsigned int nrOfThreads) const
+{
+	// The lazy points are only read on the calling thread: the ones with double coordinates are copied into a flat
+	// array for the workers, the others are answered here with exact predicates.
+	Vector_Bounded_Side result(points.size());
+	std::vector<double> coordinates;
+	std::vector<size_t> indices;
+	coordinates.reserve(2 * points.size());
+	indices.reserve(points.size());
+	for (size_t i = 0; i < points.size(); i++)
+	{
+		double x;
+		double y;
+		if (HasDoubleCoordinates(points[i], x, y))
+		{
+			coordinates.push_back(x);
+			coordinates.push_back(y);
+			indices.push_back(i);
+		}
+		else
+		{
+			Exact_Query query = { hull, points[i] };
+			result[i] = LocateInConvexPolygon(query, hull.size());
+		}
+	}
+
+	Vector_Bounded_Side located = BatchLocate(coordinates, nrOfThreads);
+	for (size_t k = 0; k < indices.size(); k++)
+	{
+		result[indices[k]] = located[k];
+	}
+	return result;
+}
+
+size_t Convex_Hull_Index::Size() const
+{
+	return xs.size();
+}
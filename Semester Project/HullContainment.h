@@ -0,0 +1,73 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Point in convex polygon in O(logn) time
+// https://cp-algorithms.com/geometry/point-in-convex-polygon.html
+
+#ifndef HULL_CONTAINMENT_H
+#define HULL_CONTAINMENT_H
+
+// Linker to Point Location Header File (Kernel and Vector_Point_2D typedefs)
+#include "PointLocation.h"
+
+// Filtered - exact orientation predicate on double coordinates
+#include "FilteredPredicates.h"
+
+// Thread helpers for batched queries
+#include "Parallel.h"
+
+// --------------------------------------------------------------------
+
+// * Vector_Bounded_Side : std::vector<CGAL::Bounded_side>
+typedef std::vector<CGAL::Bounded_side> Vector_Bounded_Side;
+
+/*
+* This class is responsible for answering "is this point inside the convex hull" queries in O(logh) time, where h
+* is the number of hull vertices. It is built once from the counter - clockwise vertex vector returned by GrahamAndrew.
+* For a query point q, a binary search over the fan of triangles (p0, pi, pi+1) finds the wedge containing q, and a single
+* orientation test against the edge (pi, pi+1) decides the answer.
+*
+* The hull vertices are kept as flat double arrays. Query points with double coordinates (every point read from a file or
+* generated by GeneratePoints2DInstance) are answered with the filtered - exact orientation predicate; points whose
+* coordinates are not doubles, or hulls whose vertices are not doubles, fall back to the exact predicates of the Kernel.
+* Every answer is exact.
+*/
+class Convex_Hull_Index
+{
+public:
+	Convex_Hull_Index(const Vector_Point_2D& convexHull);
+
+	/*
+	* Returns ON_BOUNDED_SIDE, ON_BOUNDARY or ON_UNBOUNDED_SIDE for the point (x, y).
+	*/
+	CGAL::Bounded_side Locate(double x, double y) const;
+
+	/*
+	* Returns ON_BOUNDED_SIDE, ON_BOUNDARY or ON_UNBOUNDED_SIDE for the given point.
+	*/
+	CGAL::Bounded_side Locate(const Point_2D& point) const;
+
+	/*
+	* Answers a batch of queries given as a flat coordinate array (x0, y0, x1, y1, ...) on nrOfThreads threads
+	* (0 for one thread per hardware thread), or on one thread if the hull has no double coordinates. The i-th result
+	* corresponds to the point (x_i, y_i).
+	*/
+	Vector_Bounded_Side BatchLocate(const std::vector<double>& coordinates, unsigned int nrOfThreads = 0) const;
+
+	/*
+	* Answers a batch of queries on nrOfThreads threads (0 for one thread per hardware thread).
+	* The points are read on the calling thread only: the ones with double coordinates are copied to doubles and
+	* answered in parallel, the (rare) others are answered on the calling thread, since exact evaluation of lazy
+	* numbers is not thread safe. For the same reason a hull without double coordinates is always queried on one thread.
+	*/
+	Vector_Bounded_Side BatchLocate(const Vector_Point_2D& points, unsigned int nrOfThreads = 0) const;
+
+	size_t Size() const;
+
+private:
+	Vector_Point_2D hull;
+	bool doubleHull;
+	std::vector<double> xs;
+	std::vector<double> ys;
+};
+#endif
@@ -0,0 +1,104 @@
+// Linker to Header File
+#include "InstrumentedPointLocation.h"
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// Interval arithmetic with directed rounding: the filter of the kernel predicates.
+// https://doc.cgal.org/5.0.4/Number_types/classCGAL_1_1Interval__nt.html
+#include <CGAL/Interval_nt.h>
+
+namespace
+{
+	typedef CGAL::Interval_nt<> Interval;
+
+	Interval ToInterval(const Kernel::FT& number)
+	{
+		// CGAL::to_interval
+		// Returns the interval approximation of a number; it is a single double if and only if the number is a double.
+		// https://doc.cgal.org/5.0.4/Algebraic_foundations/group__PkgAlgebraicFoundationsRef.html
+		return Interval(CGAL::to_interval(number));
+	}
+
+	bool IsDoublePoint(const Point_2D& point)
+	{
+		return ToInterval(point.x()).is_point() && ToInterval(point.y()).is_point();
+	}
+}
+
+Locate_Hit_Type ClassifyLocateResult(const Location_Result_Type& result)
+{
+	if (const Face_handle* f = boost::get<Face_handle>(&result))
+	{
+		return (*f)->is_unbounded() ? HIT_UNBOUNDED_FACE : HIT_FACE;
+	}
+	if (boost::get<HalfEdge_handle>(&result) != nullptr)
+	{
+		return HIT_EDGE;
+	}
+	return HIT_VERTEX;
+}
+
+bool SuspectExactEvaluation(const Point_2D& point, const Location_Result_Type& result)
+{
+	if (const HalfEdge_handle* e = boost::get<HalfEdge_handle>(&result))
+	{
+		// The orientation of the point with respect to the edge, as the filter of the orientation predicate computes it.
+		const Point_2D& source = (*e)->source()->point();
+		const Point_2D& target = (*e)->target()->point();
+		Interval determinant = (ToInterval(target.x()) - ToInterval(source.x())) * (ToInterval(point.y()) - ToInterval(source.y()))
+			- (ToInterval(target.y()) - ToInterval(source.y())) * (ToInterval(point.x()) - ToInterval(source.x()));
+		return !determinant.is_point();
+	}
+	if (const Vertex_handle* v = boost::get<Vertex_handle>(&result))
+	{
+		// Equal coordinates are certified by intervals only when both points are doubles.
+		return !IsDoublePoint(point) || !IsDoublePoint((*v)->point());
+	}
+	return false;
+}
+
+size_t CountWalkAlongLineFeatures(const Arrangement_2D& arr, const Point_2D& point, double top)
+{
+	if (CGAL::to_double(point.y()) >= top)
+	{
+		return 0;
+	}
+	// CGAL::zone
+	// Reports the faces, edges and vertices intersected by a curve, in order along it. The arrangement is only read, but
+	// the zone interface takes it by reference for the insertion functions built on it.
+	// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/group__PkgArrangementOnSurface2Zone.html
+	std::vector<CGAL::Object> zone;
+	CGAL::zone(const_cast<Arrangement_2D&>(arr), Arr_Curve_2D(point, Point_2D(point.x(), top)), std::back_inserter(zone));
+	return zone.size();
+}
+
+double LatencyQuantileNanoseconds(const Point_Location_Stats& stats, double quantile)
+{
+	size_t count = 0;
+	for (int k = 0; k < Latency_Buckets; k++)
+	{
+		count += stats.latencyHistogram[k];
+		if (count > 0 && count >= quantile * stats.queries)
+		{
+			return std::ldexp(1.0, k + 1);
+		}
+	}
+	return (double)stats.maxNanoseconds;
+}
+
+void DisplayPointLocationStats(const Point_Location_Stats& stats)
+{
+	std::cout << "Queries : " << stats.queries << std::endl;
+	std::cout << "Faces : " << stats.faceHits << ",  Unbounded face : " << stats.unboundedFaceHits
+		<< ",  Edges : " << stats.edgeHits << ",  Vertices : " << stats.vertexHits << std::endl;
+	std::cout << "Suspected exact queries : " << stats.suspectedExactQueries << ",  Visited features : " << stats.visitedFeatures << std::endl;
+	if (stats.queries > 0)
+	{
+		std::cout << "Latency (ns) : mean " << std::fixed << std::setprecision(0) << (double)stats.totalNanoseconds / stats.queries
+			<< ",  p50 <= " << LatencyQuantileNanoseconds(stats, 0.5)
+			<< ",  p99 <= " << LatencyQuantileNanoseconds(stats, 0.99)
+			<< ",  max " << stats.maxNanoseconds << std::endl;
+	}
+}
@@ -0,0 +1,223 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Query time statistics of a point location strategy: hit type mix, visited features, suspected exact evaluations and
+// latency.
+
+#ifndef INSTRUMENTED_POINT_LOCATION_H
+#define INSTRUMENTED_POINT_LOCATION_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// * Header that defines atomic types, which can be accessed from several threads without data races.
+// * https://www.cplusplus.com/reference/atomic/
+#include <atomic>
+
+// * Header that defines various types of type traits (std::is_same), used to pick the visited feature count of a strategy.
+// * https://www.cplusplus.com/reference/type_traits/
+#include <type_traits>
+
+// --------------------------------------------------------------------
+
+// Number of latency buckets: bucket k counts the queries that took [2^k, 2^(k+1)) nanoseconds (bucket 0 also counts
+// faster ones, the last bucket also counts slower ones).
+const int Latency_Buckets = 32;
+
+/*
+* The kind of feature a query was located on (see displayQueryResult): inside a bounded face, inside the unbounded face,
+* on an edge or on a vertex. Edge and vertex hits are the degenerate cases.
+*/
+enum Locate_Hit_Type
+{
+	HIT_FACE,
+	HIT_UNBOUNDED_FACE,
+	HIT_EDGE,
+	HIT_VERTEX
+};
+
+/*
+* This function is responsible for returning the kind of feature of the given point location result.
+*/
+Locate_Hit_Type ClassifyLocateResult(const Location_Result_Type& result);
+
+/*
+* This function is responsible for guessing, after the fact, whether the given result of locating the given point was
+* decided by an exact predicate: a point on an edge whose orientation with respect to that edge is not certified by
+* interval arithmetic, or on a vertex whose coordinates are not both doubles. It only looks at the final result, not at
+* the predicates the strategy evaluated, so it is an estimate: a query may have fallen back to exact arithmetic on
+* another edge it compared against (a face hit near an edge, for instance), and the interval computed here need not be
+* the one of the predicate the strategy called.
+*/
+bool SuspectExactEvaluation(const Point_2D& point, const Location_Result_Type& result);
+
+/*
+* This function is responsible for counting the features (faces, edges and vertices) met by the vertical ray from the
+* given point up to the given height: the zone walked by Walk_Along_Line_Point_Location, which starts above the
+* arrangement and walks down to the point. The count comes from a separate CGAL::zone call, not from the walk itself (CGAL
+* does not expose it), made through a const_cast of the arrangement, which CGAL::zone only reads. It costs about as much
+* as the query itself.
+*/
+size_t CountWalkAlongLineFeatures(const Arrangement_2D& arr, const Point_2D& point, double top);
+
+/*
+* A snapshot of the counters of an instrumented strategy.
+* faceHits, unboundedFaceHits, edgeHits and vertexHits: the hit type mix (see Locate_Hit_Type).
+* visitedFeatures: faces, edges and vertices visited by all the queries; only counted when enabled, for the naive
+* strategy (every vertex and edge) and the walk along line strategy, where it is recomputed for every query by a separate
+* CGAL::zone call along the same ray (see CountWalkAlongLineFeatures).
+* suspectedExactQueries: queries whose result suggests an exact predicate decided them (see SuspectExactEvaluation).
+* totalNanoseconds, maxNanoseconds and latencyHistogram: the time taken by the queries (see Latency_Buckets).
+*/
+struct Point_Location_Stats
+{
+	size_t queries;
+	size_t faceHits;
+	size_t unboundedFaceHits;
+	size_t edgeHits;
+	size_t vertexHits;
+	size_t visitedFeatures;
+	size_t suspectedExactQueries;
+	unsigned long long totalNanoseconds;
+	unsigned long long maxNanoseconds;
+	size_t latencyHistogram[Latency_Buckets];
+};
+
+/*
+* This function is responsible for returning an upper bound of the given quantile (0.5 for the median, 0.99, ...) of the
+* query latency, in nanoseconds, from the histogram of the given snapshot: the upper end of the bucket it falls in.
+*/
+double LatencyQuantileNanoseconds(const Point_Location_Stats& stats, double quantile);
+
+/*
+* This function is responsible for displaying the given counters to the screen.
+*/
+void DisplayPointLocationStats(const Point_Location_Stats& stats);
+
+/*
+* This class is responsible for wrapping a point location strategy (any of the four CGAL strategies) on the given
+* arrangment with query time counters. Stats returns a snapshot of them and may be called at any time, from any thread,
+* while queries run (the counters are atomic); Reset starts a new measurement period. Locate may be called from several
+* threads only if the strategy itself may (see Cached_Point_Location).
+* countVisitedFeatures enables the visited feature count, which roughly doubles the cost of a walk along line query.
+* Example: Instrumented_Point_Location<Walk_Along_Line_Point_Location> pl(arr); pl.Locate(point);
+* Point_Location_Stats stats = pl.Stats();
+*/
+template <class Strategy>
+class Instrumented_Point_Location
+{
+public:
+	Instrumented_Point_Location(const Arrangement_2D& arr, bool countVisitedFeatures = false)
+		: arr(arr), pl(arr), countVisitedFeatures(countVisitedFeatures), top(0)
+	{
+		for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+		{
+			top = std::max(top, CGAL::to_double(v->point().y()) + 1);
+		}
+		Reset();
+	}
+
+	Location_Result_Type Locate(const Point_2D& point)
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		Location_Result_Type result = pl.locate(point);
+		unsigned long long nanoseconds = (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+		queries++;
+		hits[ClassifyLocateResult(result)]++;
+		if (SuspectExactEvaluation(point, result))
+		{
+			suspectedExactQueries++;
+		}
+		if (countVisitedFeatures)
+		{
+			visitedFeatures += VisitedFeatures(point);
+		}
+		totalNanoseconds += nanoseconds;
+		unsigned long long max = maxNanoseconds;
+		while (nanoseconds > max && !maxNanoseconds.compare_exchange_weak(max, nanoseconds))
+		{
+		}
+		int bucket = 0;
+		while (bucket + 1 < Latency_Buckets && (nanoseconds >> (bucket + 1)) != 0)
+		{
+			bucket++;
+		}
+		latencyHistogram[bucket]++;
+		return result;
+	}
+
+	Point_Location_Stats Stats() const
+	{
+		Point_Location_Stats stats;
+		stats.queries = queries;
+		stats.faceHits = hits[HIT_FACE];
+		stats.unboundedFaceHits = hits[HIT_UNBOUNDED_FACE];
+		stats.edgeHits = hits[HIT_EDGE];
+		stats.vertexHits = hits[HIT_VERTEX];
+		stats.visitedFeatures = visitedFeatures;
+		stats.suspectedExactQueries = suspectedExactQueries;
+		stats.totalNanoseconds = totalNanoseconds;
+		stats.maxNanoseconds = maxNanoseconds;
+		for (int k = 0; k < Latency_Buckets; k++)
+		{
+			stats.latencyHistogram[k] = latencyHistogram[k];
+		}
+		return stats;
+	}
+
+	/*
+	* Sets every counter to 0.
+	*/
+	void Reset()
+	{
+		queries = 0;
+		for (int k = 0; k < 4; k++)
+		{
+			hits[k] = 0;
+		}
+		visitedFeatures = 0;
+		suspectedExactQueries = 0;
+		totalNanoseconds = 0;
+		maxNanoseconds = 0;
+		for (int k = 0; k < Latency_Buckets; k++)
+		{
+			latencyHistogram[k] = 0;
+		}
+	}
+
+	/*
+	* The underlying CGAL point location object.
+	*/
+	const Strategy& PointLocation() const
+	{
+		return pl;
+	}
+
+private:
+	size_t VisitedFeatures(const Point_2D& point) const
+	{
+		if (std::is_same<Strategy, Naive_Point_Location>::value)
+		{
+			return arr.number_of_vertices() + arr.number_of_edges();
+		}
+		if (std::is_same<Strategy, Walk_Along_Line_Point_Location>::value)
+		{
+			return CountWalkAlongLineFeatures(arr, point, top);
+		}
+		return 0;
+	}
+
+	const Arrangement_2D& arr;
+	Strategy pl;
+	bool countVisitedFeatures;
+	double top;
+	std::atomic<size_t> queries;
+	std::atomic<size_t> hits[4];
+	std::atomic<size_t> visitedFeatures;
+	std::atomic<size_t> suspectedExactQueries;
+	std::atomic<unsigned long long> totalNanoseconds;
+	std::atomic<unsigned long long> maxNanoseconds;
+	std::atomic<size_t> latencyHistogram[Latency_Buckets];
+};
+#endif
@@ -0,0 +1,379 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// CGAL Convex Hull Traits concept (2D)
+// https://doc.cgal.org/5.0.4/Convex_hull_2/classConvexHullTraits__2.html
+
+#ifndef INTEGER_KERNEL_H
+#define INTEGER_KERNEL_H
+
+// Linker to Point Location Header File (Kernel, Arrangement and Vector typedefs)
+#include "PointLocation.h"
+
+// * Fixed width integer types.
+// * https://www.cplusplus.com/reference/cstdint/
+#include <cstdint>
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// --------------------------------------------------------------------
+
+// Simple Cartesian Kernel:
+// * A kernel using Cartesian coordinates, whose predicates and constructions are evaluated directly with its number
+// * type: no interval filter and no lazy construction DAG.
+// * https://doc.cgal.org/5.0.4/Kernel_23/structCGAL_1_1Simple__cartesian.html
+#include <CGAL/Simple_cartesian.h>
+
+// Exact rational number type (Gmpq when GMP is available).
+// https://doc.cgal.org/5.0.4/Number_types/group__nt__cgal.html
+#include <CGAL/Exact_rational.h>
+
+// Curve Intersection Algorithm (Surface Sweep)
+// https://doc.cgal.org/5.0.4/Surface_sweep_2/index.html
+#include <CGAL/Surface_sweep_2_algorithms.h>
+
+// Fixed width 128 - bit integer of Boost Multiprecision (Boost is already required by CGAL), for compilers without a
+// native 128 - bit integer (MSVC).
+// https://www.boost.org/doc/libs/1_74_0/libs/multiprecision/doc/html/boost_multiprecision/tut/ints/cpp_int.html
+#if !defined(__SIZEOF_INT128__)
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+
+// --------------------------------------------------------------------
+
+// * Rational_Kernel : CGAL::Simple_cartesian<CGAL::Exact_rational>
+typedef CGAL::Simple_cartesian<CGAL::Exact_rational> Rational_Kernel;
+
+// Coordinates of integer points must satisfy |c| < 2^62, so that every coordinate difference fits in 64 bits and
+// every orientation determinant fits in 128 bits.
+const std::int64_t Integer_Coordinate_Bound = std::int64_t(1) << 62;
+
+// * Integer_Product : the 128 - bit signed integer the determinants are evaluated in (__int128 where the compiler has it).
+#if defined(__SIZEOF_INT128__)
+typedef __int128 Integer_Product;
+#else
+typedef boost::multiprecision::int128_t Integer_Product;
+#endif
+
+/*
+* A point with integer coordinates. With fixed - point coordinates (Fractional_Bits > 0) the stored values are the
+* coordinates multiplied by 2^Fractional_Bits.
+*/
+struct Integer_Point_2D
+{
+	std::int64_t x;
+	std::int64_t y;
+};
+
+/*
+* A line segment with integer end points.
+*/
+struct Integer_Segment_2D
+{
+	Integer_Point_2D source;
+	Integer_Point_2D target;
+};
+
+// * Vector_Integer_Point_2D : std::vector<Integer_Point_2D>
+typedef std::vector<Integer_Point_2D> Vector_Integer_Point_2D;
+
+// * Vector_Integer_Segment_2D : std::vector<Integer_Segment_2D>
+typedef std::vector<Integer_Segment_2D> Vector_Integer_Segment_2D;
+
+/*
+* This function is responsible for returning the exact orientation of the integer points p, q, r.
+* The coordinate differences are computed in 64 - bit and the determinant in 128 - bit integer arithmetic,
+* which is exact for coordinates below Integer_Coordinate_Bound.
+*/
+inline CGAL::Orientation IntegerOrientation(const Integer_Point_2D& p, const Integer_Point_2D& q, const Integer_Point_2D& r)
+{
+	Integer_Product det = (Integer_Product)(q.x - p.x) * (r.y - p.y) - (Integer_Product)(q.y - p.y) * (r.x - p.x);
+	return det > 0 ? CGAL::LEFT_TURN : (det < 0 ? CGAL::RIGHT_TURN : CGAL::COLLINEAR);
+}
+
+/*
+* A model of the ConvexHullTraits_2 concept for Integer_Point_2D. Every predicate is evaluated exactly with 64/128 - bit
+* integer arithmetic, so it can be passed to CGAL::ch_graham_andrew (or any other CGAL 2D convex hull function).
+*/
+class Integer_Hull_Traits_2
+{
+public:
+	typedef Integer_Point_2D Point_2;
+
+	struct Equal_2
+	{
+		bool operator()(const Point_2& p, const Point_2& q) const
+		{
+			return p.x == q.x && p.y == q.y;
+		}
+	};
+
+	struct Less_xy_2
+	{
+		bool operator()(const Point_2& p, const Point_2& q) const
+		{
+			return p.x < q.x || (p.x == q.x && p.y < q.y);
+		}
+	};
+
+	struct Less_yx_2
+	{
+		bool operator()(const Point_2& p, const Point_2& q) const
+		{
+			return p.y < q.y || (p.y == q.y && p.x < q.x);
+		}
+	};
+
+	struct Orientation_2
+	{
+		CGAL::Orientation operator()(const Point_2& p, const Point_2& q, const Point_2& r) const
+		{
+			return IntegerOrientation(p, q, r);
+		}
+	};
+
+	struct Left_turn_2
+	{
+		bool operator()(const Point_2& p, const Point_2& q, const Point_2& r) const
+		{
+			return IntegerOrientation(p, q, r) == CGAL::LEFT_TURN;
+		}
+	};
+
+	// True iff the signed distance of r to the oriented line pq is smaller than the signed distance of s.
+	struct Less_signed_distance_to_line_2
+	{
+		bool operator()(const Point_2& p, const Point_2& q, const Point_2& r, const Point_2& s) const
+		{
+			Integer_Product dr = (Integer_Product)(q.x - p.x) * (r.y - p.y) - (Integer_Product)(q.y - p.y) * (r.x - p.x);
+			Integer_Product ds = (Integer_Product)(q.x - p.x) * (s.y - p.y) - (Integer_Product)(q.y - p.y) * (s.x - p.x);
+			return dr < ds;
+		}
+	};
+
+	// True iff p precedes q in the counter - clockwise order of the rays from e; collinear points are ordered by
+	// decreasing distance from e, and e itself comes last. As in CGAL's kernel functor this is irreflexive (p never
+	// precedes itself), so it is a strict weak ordering on the points of one half plane of e.
+	struct Less_rotate_ccw_2
+	{
+		bool operator()(const Point_2& e, const Point_2& p, const Point_2& q) const
+		{
+			CGAL::Orientation orientation = IntegerOrientation(e, p, q);
+			if (orientation == CGAL::LEFT_TURN)
+				return true;
+			if (orientation == CGAL::RIGHT_TURN)
+				return false;
+			Equal_2 equal;
+			if (equal(p, e))
+				return false;
+			if (equal(q, e))
+				return true;
+			if (equal(p, q))
+				return false;
+			// e, q, p collinear and distinct: true iff q lies strictly between e and p along the line.
+			Integer_Product dot = (Integer_Product)(q.x - e.x) * (p.x - q.x) + (Integer_Product)(q.y - e.y) * (p.y - q.y);
+			return dot > 0;
+		}
+	};
+
+	Equal_2 equal_2_object() const { return Equal_2(); }
+	Less_xy_2 less_xy_2_object() const { return Less_xy_2(); }
+	Less_yx_2 less_yx_2_object() const { return Less_yx_2(); }
+	Orientation_2 orientation_2_object() const { return Orientation_2(); }
+	Left_turn_2 left_turn_2_object() const { return Left_turn_2(); }
+	Less_signed_distance_to_line_2 less_signed_distance_to_line_2_object() const { return Less_signed_distance_to_line_2(); }
+	Less_rotate_ccw_2 less_rotate_ccw_2_object() const { return Less_rotate_ccw_2(); }
+};
+
+// --------------------------------------------------------------------
+
+/*
+* Coordinate policy of the default pipeline: the Exact Predicates Exact Constructions Kernel (lazy exact numbers).
+*/
+struct Epeck_Coordinates
+{
+	typedef Point_2D Point;
+	typedef Line_Segment_2D Segment;
+	typedef Kernel Hull_Traits;
+	typedef Arrangment_Traits_2D Arrangement_Traits;
+	typedef Arrangement_2D Arrangement;
+
+	static typename Arrangement_Traits::Curve_2 ToCurve(const Segment& segment)
+	{
+		return typename Arrangement_Traits::Curve_2(segment);
+	}
+};
+
+/*
+* Coordinate policy for inputs with bounded integer (Fractional_Bits = 0) or fixed - point coordinates, stored as
+* integers scaled by 2^Fractional_Bits. Only convex hulls and orientation tests run in 64/128 - bit integer arithmetic,
+* with no interval filter and no lazy DAG. The surface sweep and the arrangement do NOT: intersection points of integer
+* segments are rational numbers in general, so Arrangement_Traits is the segment traits of the exact rational
+* Simple_cartesian kernel, which evaluates every predicate in unfiltered GMP rationals. That avoids the lazy DAG but not
+* the multiprecision cost, so it is not necessarily faster than EPECK; compare BM_BuildArrangmentIntegerKernel with
+* BM_BuildArrangmentIntegerInput before choosing it for arrangements.
+*/
+template <int Fractional_Bits = 0>
+struct Integer_Coordinates
+{
+	typedef Integer_Point_2D Point;
+	typedef Integer_Segment_2D Segment;
+	typedef Integer_Hull_Traits_2 Hull_Traits;
+	typedef CGAL::Arr_segment_traits_2<Rational_Kernel> Arrangement_Traits;
+	typedef CGAL::Arrangement_2<Arrangement_Traits> Arrangement;
+
+	/*
+	* Converts an integer below Integer_Coordinate_Bound to an exact rational. Exact_rational has no 64 - bit integer
+	* constructor on every platform (long is 32 bits on Windows), so the value is assembled from its quotient and
+	* remainder by 2^31, each of which fits in a 32 - bit long.
+	*/
+	static CGAL::Exact_rational ToRational(std::int64_t value)
+	{
+		const std::int64_t base = std::int64_t(1) << 31;
+		CGAL::Exact_rational result(static_cast<long>(value / base));
+		result *= CGAL::Exact_rational(1L << 16);
+		result *= CGAL::Exact_rational(1L << 15);
+		return result + CGAL::Exact_rational(static_cast<long>(value % base));
+	}
+
+	static Rational_Kernel::Point_2 ToRationalPoint(const Point& point)
+	{
+		CGAL::Exact_rational scale = ToRational(std::int64_t(1) << Fractional_Bits);
+		return Rational_Kernel::Point_2(ToRational(point.x) / scale, ToRational(point.y) / scale);
+	}
+
+	static typename Arrangement_Traits::Curve_2 ToCurve(const Segment& segment)
+	{
+		return typename Arrangement_Traits::Curve_2(ToRationalPoint(segment.source), ToRationalPoint(segment.target));
+	}
+
+	/*
+	* Converts a double coordinate to its fixed - point integer value. Returns false if the value is not a multiple
+	* of 2^-Fractional_Bits or does not fit below Integer_Coordinate_Bound.
+	*/
+	static bool ToInteger(double value, std::int64_t& result)
+	{
+		double scaled = std::ldexp(value, Fractional_Bits);
+		if (!(std::fabs(scaled) < (double)Integer_Coordinate_Bound) || std::nearbyint(scaled) != scaled)
+		{
+			return false;
+		}
+		result = (std::int64_t)scaled;
+		return true;
+	}
+
+	static Point_2D ToPoint_2D(const Point& point)
+	{
+		return Point_2D(std::ldexp((double)point.x, -Fractional_Bits), std::ldexp((double)point.y, -Fractional_Bits));
+	}
+};
+
+// --------------------------------------------------------------------
+
+/*
+* This function is responsible for converting the given EPECK points to fixed - point integer points of the given
+* coordinate policy. It returns false (leaving result incomplete) if any coordinate is not representable, in which case
+* the caller should stay on the Epeck_Coordinates pipeline.
+*/
+template <class Coordinates>
+bool ConvertToIntegerPoints(const Vector_Point_2D& points, std::vector<typename Coordinates::Point>& result)
+{
+	result.clear();
+	result.reserve(points.size());
+	for (int i = 0; i < points.size(); i++)
+	{
+		std::pair<double, double> intervalX = CGAL::to_interval(points[i].x());
+		std::pair<double, double> intervalY = CGAL::to_interval(points[i].y());
+		typename Coordinates::Point point;
+		if (intervalX.first != intervalX.second || intervalY.first != intervalY.second
+			|| !Coordinates::ToInteger(intervalX.first, point.x) || !Coordinates::ToInteger(intervalY.first, point.y))
+		{
+			return false;
+		}
+		result.push_back(point);
+	}
+	return true;
+}
+
+/*
+* This function is responsible for converting the given EPECK segments to segments of the given coordinate policy.
+* It returns false if any end point is not representable.
+*/
+template <class Coordinates>
+bool ConvertToIntegerSegments(const Vector_Line_Segment_2D& segments, std::vector<typename Coordinates::Segment>& result)
+{
+	Vector_Point_2D endPoints;
+	endPoints.reserve(2 * segments.size());
+	for (int i = 0; i < segments.size(); i++)
+	{
+		endPoints.push_back(segments[i].source());
+		endPoints.push_back(segments[i].target());
+	}
+	std::vector<typename Coordinates::Point> points;
+	if (!ConvertToIntegerPoints<Coordinates>(endPoints, points))
+	{
+		return false;
+	}
+	result.clear();
+	result.reserve(segments.size());
+	for (size_t i = 0; i < points.size(); i += 2)
+	{
+		typename Coordinates::Segment segment = { points[i], points[i + 1] };
+		result.push_back(segment);
+	}
+	return true;
+}
+
+/*
+* This algorithm is responsible for calculating the convex hull of the given points with the Graham - Andrew Scanning
+* algorithm, using the predicates of the given coordinate policy. It returns the extreme points in counter - clockwise order.
+* Example: GrahamAndrew<Integer_Coordinates<>>(integerPoints)
+*/
+template <class Coordinates>
+std::vector<typename Coordinates::Point> GrahamAndrew(const std::vector<typename Coordinates::Point>& points)
+{
+	std::vector<typename Coordinates::Point> result;
+	CGAL::ch_graham_andrew(points.begin(), points.end(), std::back_inserter(result), typename Coordinates::Hull_Traits());
+	return result;
+}
+
+/*
+* This function is responsible for using the sweep plane algorithm, with the traits of the given coordinate policy,
+* to find all the points where the given line segments intersect.
+*/
+template <class Coordinates>
+std::vector<typename Coordinates::Arrangement_Traits::Point_2> ComputeIntersectionPoints(const std::vector<typename Coordinates::Segment>& segments)
+{
+	typedef typename Coordinates::Arrangement_Traits Traits;
+	std::vector<typename Traits::Curve_2> curves;
+	curves.reserve(segments.size());
+	for (size_t i = 0; i < segments.size(); i++)
+	{
+		curves.push_back(Coordinates::ToCurve(segments[i]));
+	}
+	std::vector<typename Traits::Point_2> intersectionPoints;
+	Traits traits;
+	CGAL::compute_intersection_points(curves.begin(), curves.end(), std::back_inserter(intersectionPoints), false, traits);
+	return intersectionPoints;
+}
+
+/*
+* This function is responsible for generating a plane Arangment, with the arrangement type of the given coordinate policy,
+* based uppon the given segment vector.
+*/
+template <class Coordinates>
+typename Coordinates::Arrangement ConstructArrangment(const std::vector<typename Coordinates::Segment>& segments)
+{
+	std::vector<typename Coordinates::Arrangement_Traits::Curve_2> curves;
+	curves.reserve(segments.size());
+	for (size_t i = 0; i < segments.size(); i++)
+	{
+		curves.push_back(Coordinates::ToCurve(segments[i]));
+	}
+	typename Coordinates::Arrangement arr;
+	insert(arr, curves.begin(), curves.end());
+	return arr;
+}
+#endif
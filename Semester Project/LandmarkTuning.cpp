@@ -0,0 +1,253 @@
+// Linker to Header File
+#include "LandmarkTuning.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that defines the clocks used to time the queries (std::chrono::steady_clock).
+// * https://www.cplusplus.com/reference/chrono/
+#include <chrono>
+
+// * Header providing parametric manipulators (std::setw) for the table of results.
+// * https://www.cplusplus.com/reference/iomanip/
+#include <iomanip>
+
+struct Landmarks_Strategy
+{
+	virtual ~Landmarks_Strategy()
+	{
+	}
+
+	virtual Location_Result_Type Locate(const Point_2D& point) const = 0;
+};
+
+namespace
+{
+	typedef std::chrono::steady_clock Clock;
+
+	double ElapsedSeconds(Clock::time_point begin, Clock::time_point end)
+	{
+		return std::chrono::duration<double>(end - begin).count();
+	}
+
+	template <class Generator>
+	Generator* CreateGenerator(const Arrangement_2D& arr, size_t nrOfLandmarks)
+	{
+		return new Generator(arr, (unsigned int)nrOfLandmarks);
+	}
+
+	template <>
+	Random_Landmarks_Generator* CreateGenerator<Random_Landmarks_Generator>(const Arrangement_2D& arr, size_t nrOfLandmarks)
+	{
+		return new Random_Landmarks_Generator(arr, (int)nrOfLandmarks);
+	}
+
+	template <>
+	Vertices_Landmarks_Generator* CreateGenerator<Vertices_Landmarks_Generator>(const Arrangement_2D& arr, size_t nrOfLandmarks)
+	{
+		return new Vertices_Landmarks_Generator(arr);
+	}
+
+	// The generator is declared before (and so destroyed after) the point location that holds a pointer to it.
+	template <class Generator>
+	struct Generated_Landmarks_Strategy : public Landmarks_Strategy
+	{
+		std::unique_ptr<Generator> generator;
+		CGAL::Arr_landmarks_point_location<Arrangement_2D, Generator> pl;
+
+		Generated_Landmarks_Strategy(const Arrangement_2D& arr, size_t nrOfLandmarks)
+			: generator(CreateGenerator<Generator>(arr, nrOfLandmarks)), pl(arr, generator.get())
+		{
+		}
+
+		virtual Location_Result_Type Locate(const Point_2D& point) const
+		{
+			return pl.locate(point);
+		}
+	};
+
+	// Mean time of one query over the sample, with the index already built.
+	double MeanQuerySeconds(const Landmarks_Index& index, const Vector_Point_2D& queries)
+	{
+		if (queries.empty())
+		{
+			return 0;
+		}
+		Clock::time_point begin = Clock::now();
+		for (int i = 0; i < queries.size(); i++)
+		{
+			Location_Result_Type result = index.Locate(queries[i]);
+		}
+		return ElapsedSeconds(begin, Clock::now()) / queries.size();
+	}
+}
+
+String LandmarkGeneratorName(Landmark_Generator generator)
+{
+	switch (generator)
+	{
+	case VERTICES_LANDMARKS:
+		return "vertices";
+	case RANDOM_LANDMARKS:
+		return "random";
+	case GRID_LANDMARKS:
+		return "grid";
+	case HALTON_LANDMARKS:
+		return "halton";
+	}
+	return "unknown";
+}
+
+Landmarks_Index::Landmarks_Index(const Arrangement_2D& arr, Landmark_Generator generator, size_t nrOfLandmarks)
+	: generator(generator), nrOfLandmarks(nrOfLandmarks)
+{
+	// The generators other than the vertices one sample the bounding rectangle of the vertices, which must exist.
+	if (arr.number_of_vertices() == 0)
+	{
+		this->generator = VERTICES_LANDMARKS;
+	}
+	if (this->generator == VERTICES_LANDMARKS || this->nrOfLandmarks == 0)
+	{
+		this->nrOfLandmarks = arr.number_of_vertices();
+	}
+
+	Clock::time_point begin = Clock::now();
+	switch (this->generator)
+	{
+	case VERTICES_LANDMARKS:
+		strategy.reset(new Generated_Landmarks_Strategy<Vertices_Landmarks_Generator>(arr, this->nrOfLandmarks));
+		break;
+	case RANDOM_LANDMARKS:
+		strategy.reset(new Generated_Landmarks_Strategy<Random_Landmarks_Generator>(arr, this->nrOfLandmarks));
+		break;
+	case GRID_LANDMARKS:
+		strategy.reset(new Generated_Landmarks_Strategy<Grid_Landmarks_Generator>(arr, this->nrOfLandmarks));
+		break;
+	case HALTON_LANDMARKS:
+		strategy.reset(new Generated_Landmarks_Strategy<Halton_Landmarks_Generator>(arr, this->nrOfLandmarks));
+		break;
+	}
+	buildSeconds = ElapsedSeconds(begin, Clock::now());
+}
+
+Landmarks_Index::~Landmarks_Index()
+{
+}
+
+Location_Result_Type Landmarks_Index::Locate(const Point_2D& point) const
+{
+	return strategy->Locate(point);
+}
+
+Landmark_Generator Landmarks_Index::Generator() const
+{
+	return generator;
+}
+
+size_t Landmarks_Index::Landmarks() const
+{
+	return nrOfLandmarks;
+}
+
+double Landmarks_Index::BuildSeconds() const
+{
+	return buildSeconds;
+}
+
+Landmark_Tuning TuneLandmarks(const Arrangement_2D& arr, const Vector_Point_2D& sampleQueries, double buildBudgetSeconds)
+{
+	// Landmarks per vertex, as num / den.
+	const size_t Numerators[] = { 1, 1, 1, 1, 1, 2 };
+	const size_t Denominators[] = { 16, 8, 4, 2, 1, 1 };
+
+	size_t nrOfVertices = std::max<size_t>(1, arr.number_of_vertices());
+	Landmark_Tuning tuning;
+	const Landmark_Trial* best = nullptr;
+	const Landmark_Trial* fastestBuild = nullptr;
+
+	for (Landmark_Generator generator : Landmark_Generators)
+	{
+		size_t previousCount = 0;
+		for (int k = 0; k < 6; k++)
+		{
+			size_t count = std::max<size_t>(1, nrOfVertices * Numerators[k] / Denominators[k]);
+			if (generator == VERTICES_LANDMARKS)
+			{
+				count = nrOfVertices;
+			}
+			if (count == previousCount)
+			{
+				continue;
+			}
+			previousCount = count;
+
+			Landmarks_Index index(arr, generator, count);
+			Landmark_Trial trial;
+			trial.generator = index.Generator();
+			trial.landmarks = index.Landmarks();
+			trial.buildSeconds = index.BuildSeconds();
+			trial.withinBudget = trial.buildSeconds <= buildBudgetSeconds;
+			trial.meanQuerySeconds = trial.withinBudget ? MeanQuerySeconds(index, sampleQueries) : 0;
+			tuning.trials.push_back(trial);
+			if (!trial.withinBudget)
+			{
+				break;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < tuning.trials.size(); i++)
+	{
+		const Landmark_Trial& trial = tuning.trials[i];
+		if (trial.withinBudget && (best == nullptr || trial.meanQuerySeconds < best->meanQuerySeconds))
+		{
+			best = &trial;
+		}
+		if (fastestBuild == nullptr || trial.buildSeconds < fastestBuild->buildSeconds)
+		{
+			fastestBuild = &trial;
+		}
+	}
+	if (best == nullptr)
+	{
+		best = fastestBuild;
+	}
+	tuning.generator = best->generator;
+	tuning.landmarks = best->landmarks;
+	tuning.buildSeconds = best->buildSeconds;
+	tuning.meanQuerySeconds = best->meanQuerySeconds;
+	return tuning;
+}
+
+void DisplayLandmarkTuning(const Landmark_Tuning& tuning)
+{
+	for (size_t i = 0; i < tuning.trials.size(); i++)
+	{
+		const Landmark_Trial& trial = tuning.trials[i];
+		std::cout << std::left << std::setw(10) << LandmarkGeneratorName(trial.generator) << std::right
+			<< std::setw(10) << trial.landmarks << " landmarks"
+			<< std::fixed << std::setprecision(3) << "  build " << trial.buildSeconds * 1e3 << " ms";
+		if (trial.withinBudget)
+		{
+			std::cout << "  query " << trial.meanQuerySeconds * 1e6 << " us";
+		}
+		else
+		{
+			std::cout << "  over budget";
+		}
+		std::cout << std::endl;
+	}
+	std::cout << "Chosen : " << LandmarkGeneratorName(tuning.generator) << " with " << tuning.landmarks << " landmarks" << std::endl;
+}
+
+void LocateAndDisplayPointLandmarks(const Arrangement_2D& arr, const Vector_Point_2D& points, Landmark_Generator generator, size_t nrOfLandmarks)
+{
+	Landmarks_Index landmarks_pl(arr, generator, nrOfLandmarks);
+	Location_Result_Type Point_Location_Result_Object;
+	for (int i = 0; i < points.size(); i++)
+	{
+		Point_Location_Result_Object = landmarks_pl.Locate(points[i]);
+		displayQueryResult(points[i], Point_Location_Result_Object);
+	}
+}
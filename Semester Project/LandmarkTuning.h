@@ -0,0 +1,147 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Landmark generators of the landmarks point location strategy
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/index.html#arr_sssecpl_lm
+
+#ifndef LANDMARK_TUNING_H
+#define LANDMARK_TUNING_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// * Header that defines smart pointers (std::unique_ptr) for dynamic memory management.
+// * https://www.cplusplus.com/reference/memory/
+#include <memory>
+
+// --------------------------------------------------------------------
+
+// The landmarks are the vertices of the arrangement (the default generator of Arr_landmarks_point_location).
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__landmarks__vertices__generator.html
+#include <CGAL/Arr_point_location/Arr_lm_vertices_generator.h>
+
+// The landmarks are points drawn uniformly at random in the bounding rectangle of the arrangement.
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__random__landmarks__generator.html
+#include <CGAL/Arr_point_location/Arr_lm_random_generator.h>
+
+// The landmarks are the points of a uniform grid over the bounding rectangle; the nearest landmark is found by rounding,
+// without a kd - tree search.
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__grid__landmarks__generator.html
+#include <CGAL/Arr_point_location/Arr_lm_grid_generator.h>
+
+// The landmarks are the points of a Halton sequence over the bounding rectangle (well spread, deterministic).
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__halton__landmarks__generator.html
+#include <CGAL/Arr_point_location/Arr_lm_halton_generator.h>
+
+// --------------------------------------------------------------------
+
+// Vertices_Landmarks_Generator :: CGAL::Arr_landmarks_vertices_generator<Arrangement_2D>
+typedef CGAL::Arr_landmarks_vertices_generator<Arrangement_2D> Vertices_Landmarks_Generator;
+
+// Random_Landmarks_Generator :: CGAL::Arr_random_landmarks_generator<Arrangement_2D>
+typedef CGAL::Arr_random_landmarks_generator<Arrangement_2D> Random_Landmarks_Generator;
+
+// Grid_Landmarks_Generator :: CGAL::Arr_grid_landmarks_generator<Arrangement_2D>
+typedef CGAL::Arr_grid_landmarks_generator<Arrangement_2D> Grid_Landmarks_Generator;
+
+// Halton_Landmarks_Generator :: CGAL::Arr_halton_landmarks_generator<Arrangement_2D>
+typedef CGAL::Arr_halton_landmarks_generator<Arrangement_2D> Halton_Landmarks_Generator;
+
+// The landmark generators that can be selected at run time.
+enum Landmark_Generator
+{
+	VERTICES_LANDMARKS,
+	RANDOM_LANDMARKS,
+	GRID_LANDMARKS,
+	HALTON_LANDMARKS
+};
+
+const Landmark_Generator Landmark_Generators[] = { VERTICES_LANDMARKS, RANDOM_LANDMARKS, GRID_LANDMARKS, HALTON_LANDMARKS };
+
+/*
+* This function is responsible for returning the name of the given generator ("vertices", "random", "grid", "halton").
+*/
+String LandmarkGeneratorName(Landmark_Generator generator);
+
+// The generator and landmarks point location pair behind a Landmarks_Index (defined in LandmarkTuning.cpp).
+struct Landmarks_Strategy;
+
+/*
+* This class is responsible for a landmarks point location attached to an arrangement, with the landmark generator and
+* the number of landmarks chosen at run time. The index owns its generator, which is an observer of the arrangement
+* like the point location itself, so both are kept up to date when the arrangement changes.
+* The vertices generator always uses one landmark per vertex; for the others, nrOfLandmarks = 0 also means one
+* landmark per vertex.
+*/
+class Landmarks_Index
+{
+public:
+	Landmarks_Index(const Arrangement_2D& arr, Landmark_Generator generator, size_t nrOfLandmarks = 0);
+	~Landmarks_Index();
+
+	Location_Result_Type Locate(const Point_2D& point) const;
+
+	Landmark_Generator Generator() const;
+
+	/*
+	* Number of landmarks requested from the generator when the index was built.
+	*/
+	size_t Landmarks() const;
+
+	/*
+	* Time taken to build the index (generating and locating the landmarks, building their search structure).
+	*/
+	double BuildSeconds() const;
+
+private:
+	std::unique_ptr<Landmarks_Strategy> strategy;
+	Landmark_Generator generator;
+	size_t nrOfLandmarks;
+	double buildSeconds;
+};
+
+/*
+* One configuration measured by TuneLandmarks. meanQuerySeconds is 0 when the configuration went over the build budget
+* (its queries are then not measured).
+*/
+struct Landmark_Trial
+{
+	Landmark_Generator generator;
+	size_t landmarks;
+	double buildSeconds;
+	double meanQuerySeconds;
+	bool withinBudget;
+};
+
+/*
+* The configuration chosen by TuneLandmarks, together with every configuration that was measured.
+*/
+struct Landmark_Tuning
+{
+	Landmark_Generator generator;
+	size_t landmarks;
+	double buildSeconds;
+	double meanQuerySeconds;
+	std::vector<Landmark_Trial> trials;
+};
+
+/*
+* This function is responsible for choosing the landmark generator and the number of landmarks that give the lowest
+* mean query latency on the given arrangment, among the configurations whose build time stays within the given budget
+* (in seconds). Every generator is tried with 1/16, 1/8, 1/4, 1/2, 1 and 2 landmarks per vertex (the vertices generator
+* only with one per vertex); a generator stops growing at its first configuration over the budget. The queries should be a
+* sample of the expected workload. If no configuration fits the budget, the one that built the fastest is returned.
+*/
+Landmark_Tuning TuneLandmarks(const Arrangement_2D& arr, const Vector_Point_2D& sampleQueries, double buildBudgetSeconds);
+
+/*
+* This function is responsible for displaying the trials and the choice of a landmark tuning to the screen.
+*/
+void DisplayLandmarkTuning(const Landmark_Tuning& tuning);
+
+/*
+* This function is responsible for performing a series of point location querys on the given points vector.
+* The algorithmic approach used is: LandMarks_Point_Location, with the given generator and number of landmarks.
+*/
+void LocateAndDisplayPointLandmarks(const Arrangement_2D& arr, const Vector_Point_2D& points, Landmark_Generator generator, size_t nrOfLandmarks);
+#endif
@@ -0,0 +1,143 @@
+// Linker to Header File
+#include "LayerOverlay.h"
+
+namespace
+{
+	typedef std::unordered_map<const Arrangement_2D::Face*, size_t> Face_Index;
+
+	// Overlay traits: the functions called by the overlay sweep for every vertex, edge and face of the result, with the
+	// features of layer A and layer B it was created from.
+	// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classOverlayTraits.html
+	class Layer_Overlay_Traits
+	{
+	public:
+		typedef Arrangement_2D::Vertex_const_handle Vertex_handle_A;
+		typedef Arrangement_2D::Halfedge_const_handle Halfedge_handle_A;
+		typedef Arrangement_2D::Face_const_handle Face_handle_A;
+		typedef Arrangement_2D::Vertex_const_handle Vertex_handle_B;
+		typedef Arrangement_2D::Halfedge_const_handle Halfedge_handle_B;
+		typedef Arrangement_2D::Face_const_handle Face_handle_B;
+		typedef Overlay_Arrangement_2D::Vertex_handle Vertex_handle_R;
+		typedef Overlay_Arrangement_2D::Halfedge_handle Halfedge_handle_R;
+		typedef Overlay_Arrangement_2D::Face_handle Face_handle_R;
+
+		Layer_Overlay_Traits(const Face_Index& facesA, const Face_Index& facesB) : facesA(facesA), facesB(facesB)
+		{
+		}
+
+		void create_vertex(Vertex_handle_A, Vertex_handle_B, Vertex_handle_R v) const
+		{
+			v->set_data(LAYER_A | LAYER_B);
+		}
+
+		void create_vertex(Vertex_handle_A, Halfedge_handle_B, Vertex_handle_R v) const
+		{
+			v->set_data(LAYER_A | LAYER_B);
+		}
+
+		void create_vertex(Vertex_handle_A, Face_handle_B, Vertex_handle_R v) const
+		{
+			v->set_data(LAYER_A);
+		}
+
+		void create_vertex(Halfedge_handle_A, Vertex_handle_B, Vertex_handle_R v) const
+		{
+			v->set_data(LAYER_A | LAYER_B);
+		}
+
+		void create_vertex(Face_handle_A, Vertex_handle_B, Vertex_handle_R v) const
+		{
+			v->set_data(LAYER_B);
+		}
+
+		void create_vertex(Halfedge_handle_A, Halfedge_handle_B, Vertex_handle_R v) const
+		{
+			v->set_data(LAYER_A | LAYER_B);
+		}
+
+		void create_edge(Halfedge_handle_A, Halfedge_handle_B, Halfedge_handle_R e) const
+		{
+			e->set_data(LAYER_A | LAYER_B);
+			e->twin()->set_data(LAYER_A | LAYER_B);
+		}
+
+		void create_edge(Halfedge_handle_A, Face_handle_B, Halfedge_handle_R e) const
+		{
+			e->set_data(LAYER_A);
+			e->twin()->set_data(LAYER_A);
+		}
+
+		void create_edge(Face_handle_A, Halfedge_handle_B, Halfedge_handle_R e) const
+		{
+			e->set_data(LAYER_B);
+			e->twin()->set_data(LAYER_B);
+		}
+
+		void create_face(Face_handle_A f1, Face_handle_B f2, Face_handle_R f) const
+		{
+			Overlay_Face_Data data;
+			data.faceA = facesA.at(&(*f1));
+			data.faceB = facesB.at(&(*f2));
+			f->set_data(data);
+		}
+
+	private:
+		const Face_Index& facesA;
+		const Face_Index& facesB;
+	};
+}
+
+std::unordered_map<const Arrangement_2D::Face*, size_t> IndexFaces(const Arrangement_2D& arr)
+{
+	Face_Index index;
+	index.reserve(arr.number_of_faces());
+	size_t i = 0;
+	for (Arrangement_2D::Face_const_iterator f = arr.faces_begin(); f != arr.faces_end(); f++, i++)
+	{
+		index[&(*f)] = i;
+	}
+	return index;
+}
+
+void OverlayLayers(const Arrangement_2D& layerA, const Arrangement_2D& layerB, Overlay_Arrangement_2D& overlay)
+{
+	Face_Index facesA = IndexFaces(layerA);
+	Face_Index facesB = IndexFaces(layerB);
+	Layer_Overlay_Traits traits(facesA, facesB);
+	CGAL::overlay(layerA, layerB, overlay, traits);
+}
+
+std::vector<Overlay_Face_handle> OverlayFaces(const Overlay_Arrangement_2D& overlay)
+{
+	std::vector<Overlay_Face_handle> faces;
+	faces.reserve(overlay.number_of_faces());
+	for (Overlay_Arrangement_2D::Face_const_iterator f = overlay.faces_begin(); f != overlay.faces_end(); f++)
+	{
+		faces.push_back(f);
+	}
+	return faces;
+}
+
+void DisplayOverlaySummary(const Overlay_Arrangement_2D& overlay)
+{
+	size_t vertices[4] = { 0, 0, 0, 0 };
+	size_t edges[4] = { 0, 0, 0, 0 };
+	for (Overlay_Arrangement_2D::Vertex_const_iterator v = overlay.vertices_begin(); v != overlay.vertices_end(); v++)
+	{
+		vertices[v->data() & 3]++;
+	}
+	for (Overlay_Arrangement_2D::Edge_const_iterator e = overlay.edges_begin(); e != overlay.edges_end(); e++)
+	{
+		edges[e->data() & 3]++;
+	}
+	std::cout << "Displaying overlay size:" << std::endl
+		<< "Vertices : " << overlay.number_of_vertices()
+		<< ",  Edges : " << overlay.number_of_edges()
+		<< ",  Faces : " << overlay.number_of_faces() << std::endl;
+	std::cout << "Vertices from layer A only : " << vertices[LAYER_A]
+		<< ",  layer B only : " << vertices[LAYER_B]
+		<< ",  both : " << vertices[LAYER_A | LAYER_B] << std::endl;
+	std::cout << "Edges from layer A only : " << edges[LAYER_A]
+		<< ",  layer B only : " << edges[LAYER_B]
+		<< ",  both : " << edges[LAYER_A | LAYER_B] << std::endl;
+}
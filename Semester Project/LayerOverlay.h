@@ -0,0 +1,116 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Overlay of two arrangements (layers)
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/index.html#arr_secoverlay
+
+#ifndef LAYER_OVERLAY_H
+#define LAYER_OVERLAY_H
+
+// Linker to Point Location Header File (Arrangement typedefs)
+#include "PointLocation.h"
+
+// Chunked parallel loop over the overlay faces
+#include "Parallel.h"
+
+// * Unordered maps are associative containers that store elements formed by the combination of a key value and a mapped value.
+// * https://www.cplusplus.com/reference/unordered_map/unordered_map/
+#include <unordered_map>
+
+// --------------------------------------------------------------------
+
+// The class Arr_extended_dcel<Traits, VertexData, HalfedgeData, FaceData> is a DCEL whose vertex, halfedge and face
+// records carry an extra data field of the given types.
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__extended__dcel.html
+#include <CGAL/Arr_extended_dcel.h>
+
+// The function template overlay(arr_a, arr_b, arr_r, ovl_traits) computes the overlay of two arrangements with a single
+// sweep, and notifies the overlay traits of every vertex, edge and face it creates together with their sources.
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/group__PkgArrangementOnSurface2Overlay.html
+#include <CGAL/Arr_overlay_2.h>
+
+// --------------------------------------------------------------------
+
+/*
+* The layers a vertex or an edge of an overlay comes from: LAYER_A, LAYER_B or both (LAYER_A | LAYER_B). A vertex lying
+* inside a face of the other layer, or an edge running through it, comes from one layer only.
+*/
+enum Overlay_Layer
+{
+	LAYER_A = 1,
+	LAYER_B = 2
+};
+
+/*
+* The source faces of a face of an overlay: the face of layer A and the face of layer B it lies in, given by their
+* position in the face order of their layer (faces_begin() to faces_end(), the unbounded face included).
+*/
+struct Overlay_Face_Data
+{
+	size_t faceA;
+	size_t faceB;
+};
+
+// Overlay_Dcel :: CGAL::Arr_extended_dcel<Arrangment_Traits_2D, int, int, Overlay_Face_Data>
+// The vertex and halfedge data is their Overlay_Layer mask.
+typedef CGAL::Arr_extended_dcel<Arrangment_Traits_2D, int, int, Overlay_Face_Data> Overlay_Dcel;
+
+// Overlay_Arrangement_2D :: CGAL::Arrangement_2<Arrangment_Traits_2D, Overlay_Dcel>
+typedef CGAL::Arrangement_2<Arrangment_Traits_2D, Overlay_Dcel> Overlay_Arrangement_2D;
+
+// Overlay_Face_handle :: Overlay_Arrangement_2D::Face_const_handle
+typedef Overlay_Arrangement_2D::Face_const_handle Overlay_Face_handle;
+
+/*
+* This function is responsible for returning the position of every face of the given arrangment in its face order, keyed
+* by the address of the face record (see Overlay_Face_Data).
+*/
+std::unordered_map<const Arrangement_2D::Face*, size_t> IndexFaces(const Arrangement_2D& arr);
+
+/*
+* This function is responsible for computing the overlay of the two given layers into overlay. Every vertex and edge is
+* tagged with the layers it comes from and every face with its source face in both layers, during the sweep.
+* Example: Overlay_Arrangement_2D overlay; OverlayLayers(BuildArrangmentWithHull(segments, Vector_Point_2D()),
+* BuildArrangmentWithHull(Vector_Line_Segment_2D(), convexHull), overlay);
+*/
+void OverlayLayers(const Arrangement_2D& layerA, const Arrangement_2D& layerB, Overlay_Arrangement_2D& overlay);
+
+/*
+* This function is responsible for returning the faces of the given overlay in face order, so that they can be processed
+* by index (and in parallel). The attributes returned by MergeFaceAttributes follow this order.
+*/
+std::vector<Overlay_Face_handle> OverlayFaces(const Overlay_Arrangement_2D& overlay);
+
+/*
+* This function is responsible for merging per face attributes of the two layers into attributes of the overlay faces:
+* result[i] = merge(attributesA[faceA], attributesB[faceB]) for the i-th face of the overlay, where attributesA and
+* attributesB hold one value per face of their layer in face order. The merge runs on nrOfThreads threads (0 for one per
+* hardware thread) after the sweep, so it must not modify shared state. The merged attribute must not be bool, since
+* std::vector<bool> packs its elements and concurrent writes would race (use char).
+* Example: zoning codes of layer A and road classes of layer B merged into a zoning and road class per overlay face.
+*/
+template <class AttributeA, class AttributeB, class Merge>
+auto MergeFaceAttributes(const Overlay_Arrangement_2D& overlay, const std::vector<AttributeA>& attributesA,
+	const std::vector<AttributeB>& attributesB, Merge merge, unsigned int nrOfThreads = 0)
+	-> std::vector<typename std::decay<decltype(merge(attributesA[0], attributesB[0]))>::type>
+{
+	typedef typename std::decay<decltype(merge(attributesA[0], attributesB[0]))>::type Attribute;
+	std::vector<Overlay_Face_handle> faces = OverlayFaces(overlay);
+	std::vector<Attribute> result(faces.size());
+	ParallelFor(faces.size(), [&](size_t begin, size_t end, unsigned int)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			const Overlay_Face_Data& data = faces[i]->data();
+			result[i] = merge(attributesA[data.faceA], attributesB[data.faceB]);
+		}
+	}, nrOfThreads);
+	return result;
+}
+
+/*
+* This function is responsible for displaying the size of the given overlay and the number of vertices and edges that
+* come from layer A only, layer B only and both.
+*/
+void DisplayOverlaySummary(const Overlay_Arrangement_2D& overlay);
+#endif
@@ -1,109 +1,371 @@
-// Linker to Header File
-#include "PointLocation.h"
-
-
-int main()
-{
-    std::chrono::steady_clock::time_point begin;
-    std::chrono::steady_clock::time_point end;
-    
-    //Vector_Point_2D randomPoints = GeneratePoints2DInstance(0, 10000, 10000);
-    //DisplayPoints(randomPoints, 3);
-    
-    std::cout << "Reading points from file 'points.txt':" << std::endl;
-    Vector_Point_2D file_points = ReadPointsFromFile("points.txt");
-    std::cout << "--------------------------------------------------" << std::endl;
-    
-    //std::cout << "Displaying points (.3 precission):\n" << std::endl;
-    //DisplayPoints(file_points,3);
-    //std::cout << "--------------------------------------------------" << std::endl;
-
-    std::cout << "Reading line segment points from 'segments.txt':" << std::endl;
-    Vector_Point_2D file_segment_points = ReadPointsFromFile("segments.txt");
-    std::cout << "--------------------------------------------------" << std::endl;
-    std::cout << "Converting segment points to segments:" << std::endl;
-    Vector_Line_Segment_2D file_line_segments = ConvertSegmentsFromFile(file_segment_points);
-    std::cout << "--------------------------------------------------" << std::endl;
-    
-    //std::cout << "Displaying line segments (.3 precission):\n" << std::endl;
-    //DisplayLineSegments(file_line_segments, 3);
-    //std::cout << "--------------------------------------------------" << std::endl;
-
-    std::cout << "Merge all points of A:" << std::endl;
-    Vector_Point_2D points_of_A = file_points;
-    points_of_A.insert(points_of_A.end(), file_segment_points.begin(), file_segment_points.end());
-    std::cout << "--------------------------------------------------" << std::endl;
-    
-    std::cout << "Calculating convex hull via Graham Andrew Algorithm." << std::endl;
-    begin = std::chrono::steady_clock::now();
-    Vector_Point_2D convexHull = GrahamAndrew(points_of_A);
-    end = std::chrono::steady_clock::now();
-    std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
-    WriteConvexHullSegmentsToFile(convexHull);
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    //std::cout << "Displaying convex hull(.3 precission):\n" << std::endl;
-    //DisplayPoints(convexHull, 3);
-    //std::cout << "--------------------------------------------------" << std::endl;
-    
-    std::cout << "Reading line segment points from 'convexHull.txt':" << std::endl;
-    Vector_Point_2D convex_segment_points = ReadPointsFromFile("convexHull.txt");
-    std::cout << "--------------------------------------------------" << std::endl;
-    
-    std::cout << "Converting segment points to segments:" << std::endl;
-    Vector_Line_Segment_2D convex_line_segments = ConvertSegmentsFromFile(convex_segment_points);
-    std::cout << "--------------------------------------------------" << std::endl;
-    
-    std::cout << "Displaying Convex Hull line segments (.3 precission):\n" << std::endl;
-    DisplayLineSegments(convex_line_segments, 3);
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    Vector_Line_Segment_2D totalLineSegments = file_line_segments;
-    totalLineSegments.insert(totalLineSegments.end(), convex_line_segments.begin(), convex_line_segments.end());
-
-    std::cout << "Creating the corresponding arrangment:" << std::endl;
-    Arrangement_2D arr = ConstructArrangment(totalLineSegments);
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    std::cout << "Saving Arrangment to arrangment.txt:" << std::endl;
-    SaveArrangment(arr);
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    std::cout << "Loading arrangment from file:" << std::endl;
-    LoadArrangment();
-    std::cout << "--------------------------------------------------" << std::endl;
-
-    //std::cout << "Displaying faces:" << std::endl;
-    //DisplayFacesOfArrangment(arr);
-    //std::cout << "--------------------------------------------------" << std::endl;
-    
-    //std::cout << "=== Naive Point Location ===" << std::endl;
-    //begin = std::chrono::steady_clock::now();
-    //LocateAndDisplayPointNaive(arr, file_points);
-    //end = std::chrono::steady_clock::now();
-    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
-    //std::cout << "--------------------------------------------------" << std::endl;
-    
-    //std::cout << "=== Walk Along Line Point Location ===" << std::endl;
-    //begin = std::chrono::steady_clock::now();
-    //LocateAndDisplayPointWalkAlongLine(arr, file_points);
-    //end = std::chrono::steady_clock::now();
-    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
-    //std::cout << "--------------------------------------------------" << std::endl;
-
-    
-    //std::cout << "=== Landmarks Point Location ===" << std::endl;
-    //begin = std::chrono::steady_clock::now();
-    //LocateAndDisplayPointLandmarks(arr, file_points);
-    //end = std::chrono::steady_clock::now();
-    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
-    //std::cout << "--------------------------------------------------" << std::endl;
-    
-    
-    //std::cout << "=== Trapezoid Point Location ===" << std::endl;
-    //begin = std::chrono::steady_clock::now();
-    //LocateAndDisplayPointTrapezoid(arr, file_points);
-    //end = std::chrono::steady_clock::now();
-    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
-    //std::cout << "--------------------------------------------------" << std::endl;
-}
+// Linker to Header File
+#include "PointLocation.h"
+#include "FaceCache.h"
+#include "ArrangementIO.h"
+#include "IntegerKernel.h"
+#include "MemoryFootprint.h"
+#include "LandmarkTuning.h"
+#include "TrapezoidIndex.h"
+#include "TiledPointLocation.h"
+#include "QueryCache.h"
+#include "ArrangementCompaction.h"
+#include "LayerOverlay.h"
+#include "SnapRounding.h"
+#include "InstrumentedPointLocation.h"
+#include "VerticalDecomposition.h"
+#include "FrozenArrangement.h"
+#include "PersistentSlabPointLocation.h"
+#include "WindowQuery.h"
+
+
+/*
+* Usage: point_location [--no-convex-hull-file]
+* Runs the semester project on 'points.txt' and 'segments.txt'. The convex hull segments are also written to
+* 'convexHull.txt', unless --no-convex-hull-file is given. Exit status: 0 on success, 1 when a file cannot be read or
+* written, on invalid arguments, or when a cross check fails.
+*/
+int main(int argc, char* argv[])
+{
+    bool writeConvexHullFile = true;
+    for (int i = 1; i < argc; i++)
+    {
+        String argument = argv[i];
+        if (argument == "--no-convex-hull-file")
+        {
+            writeConvexHullFile = false;
+        }
+        else
+        {
+            std::cout << "Unknown argument: " << argument << std::endl;
+            return 1;
+        }
+    }
+
+    std::chrono::steady_clock::time_point begin;
+    std::chrono::steady_clock::time_point end;
+    
+    //Vector_Point_2D randomPoints = GeneratePoints2DInstance(0, 10000, 10000);
+    //DisplayPoints(randomPoints, 3);
+    
+    std::cout << "Reading points from file 'points.txt':" << std::endl;
+    Vector_Point_2D file_points = ReadPointsFromFile("points.txt");
+    if (file_points.empty())
+    {
+        std::cout << "Unable to read 'points.txt'." << std::endl;
+        return 1;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+    
+    //std::cout << "Displaying points (.3 precission):\n" << std::endl;
+    //DisplayPoints(file_points,3);
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Reading line segment points from 'segments.txt':" << std::endl;
+    Vector_Point_2D file_segment_points = ReadPointsFromFile("segments.txt");
+    std::cout << "--------------------------------------------------" << std::endl;
+    std::cout << "Converting segment points to segments:" << std::endl;
+    Vector_Line_Segment_2D file_line_segments = ConvertSegmentsFromFile(file_segment_points);
+    std::cout << "--------------------------------------------------" << std::endl;
+    
+    //std::cout << "Displaying line segments (.3 precission):\n" << std::endl;
+    //DisplayLineSegments(file_line_segments, 3);
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Merge all points of A:" << std::endl;
+    Vector_Point_2D points_of_A = file_points;
+    points_of_A.insert(points_of_A.end(), file_segment_points.begin(), file_segment_points.end());
+    std::cout << "--------------------------------------------------" << std::endl;
+    
+    std::cout << "Calculating convex hull via Graham Andrew Algorithm." << std::endl;
+    begin = std::chrono::steady_clock::now();
+    Vector_Point_2D convexHull = GrahamAndrew(points_of_A);
+    end = std::chrono::steady_clock::now();
+    std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    // The sample data has integer coordinates, so the same hull can be computed with exact integer predicates.
+    Vector_Integer_Point_2D integer_points_of_A;
+    if (ConvertToIntegerPoints<Integer_Coordinates<>>(points_of_A, integer_points_of_A))
+    {
+        std::cout << "Calculating convex hull via Graham Andrew Algorithm (integer kernel)." << std::endl;
+        begin = std::chrono::steady_clock::now();
+        Vector_Integer_Point_2D integerConvexHull = GrahamAndrew<Integer_Coordinates<>>(integer_points_of_A);
+        end = std::chrono::steady_clock::now();
+        std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() << " microseconds"
+            << " (" << integerConvexHull.size() << " vs " << convexHull.size() << " hull points with EPECK)" << std::endl;
+        bool sameHull = integerConvexHull.size() == convexHull.size();
+        for (size_t i = 0; sameHull && i < convexHull.size(); i++)
+        {
+            sameHull = Integer_Coordinates<>::ToPoint_2D(integerConvexHull[i]) == convexHull[i];
+        }
+        if (!sameHull)
+        {
+            std::cout << "The integer kernel convex hull differs from the EPECK one." << std::endl;
+            return 1;
+        }
+        std::cout << "--------------------------------------------------" << std::endl;
+    }
+
+    // The convex hull file is an optional by-product (see --no-convex-hull-file): it is written on a background thread,
+    // while the arrangement is built from the hull kept in memory.
+    std::future<bool> convexHullFile;
+    if (writeConvexHullFile)
+    {
+        std::cout << "Writing convex hull segments to 'convexHull.txt' in the background." << std::endl;
+        convexHullFile = WriteConvexHullSegmentsToFileAsync(convexHull, "convexHull.txt");
+        std::cout << "--------------------------------------------------" << std::endl;
+    }
+
+    //std::cout << "Displaying convex hull(.3 precission):\n" << std::endl;
+    //DisplayPoints(convexHull, 3);
+    //std::cout << "--------------------------------------------------" << std::endl;
+    
+    std::cout << "Converting convex hull to segments:" << std::endl;
+    Vector_Line_Segment_2D convex_line_segments = ConvexHullToSegments(convexHull);
+    std::cout << "--------------------------------------------------" << std::endl;
+    
+    std::cout << "Displaying Convex Hull line segments (.3 precission):\n" << std::endl;
+    DisplayLineSegments(convex_line_segments, 3);
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Creating the corresponding arrangment:" << std::endl;
+    begin = std::chrono::steady_clock::now();
+    Arrangement_2D arr = ConstructArrangmentWithHull(file_line_segments, convexHull);
+    end = std::chrono::steady_clock::now();
+    std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Saving Arrangment to arrangment.txt in the background:" << std::endl;
+    Face_Geometry_Cache faceCache(arr);
+    std::future<bool> arrangmentFile = SaveArrangmentAsync(arr, faceCache, "arrangment.txt");
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Loading arrangment from file:" << std::endl;
+    if (!arrangmentFile.get())
+    {
+        std::cout << "Unable to write 'arrangment.txt'." << std::endl;
+        return 1;
+    }
+    Arrangement_2D loadedArr;
+    if (!LoadArrangment("arrangment.txt", loadedArr))
+    {
+        std::cout << "Unable to read 'arrangment.txt'." << std::endl;
+        return 1;
+    }
+    std::cout << "Displaying arrangement size:" << std::endl
+        << "Vertices : " << loadedArr.number_of_vertices()
+        << ",  Edges : " << loadedArr.number_of_edges()
+        << ",  Faces : " << loadedArr.number_of_faces() << std::endl;
+    if (loadedArr.number_of_vertices() != arr.number_of_vertices() || loadedArr.number_of_edges() != arr.number_of_edges()
+        || loadedArr.number_of_faces() != arr.number_of_faces())
+    {
+        std::cout << "The loaded arrangment differs from the saved one." << std::endl;
+        return 1;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Snap rounding the segments onto the unit grid, and saving / loading the result:" << std::endl;
+    Arrangement_2D snappedArr;
+    Snap_Rounding_Report snapRounding;
+    ConstructSnappedArrangment(file_line_segments, DefaultSnapRoundingOptions(), snappedArr, &snapRounding);
+    DisplaySnapRoundingReport(snapRounding);
+    if (!CheckArrangmentRoundTrip(snappedArr, "snapped_arrangment.txt"))
+    {
+        std::cout << "The snap rounded arrangment does not survive a save / load round trip." << std::endl;
+        return 1;
+    }
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Cross checking the point location strategies on the points of 'points.txt':" << std::endl;
+    if (!CrossCheckPointLocation(arr, file_points))
+    {
+        return 1;
+    }
+    std::cout << "All strategies agree with the naive one on " << file_points.size() << " points." << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Cross checking the vertical decomposition and ray shooting on the points of 'points.txt' and 1000 seeded points:" << std::endl;
+    if (!CrossCheckVerticalDecomposition(arr, file_points, 1000, 1))
+    {
+        return 1;
+    }
+    std::cout << "Every point lies in a trapezoid of its face, and both ray shooting strategies agree." << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Cross checking the frozen arrangment against CGAL point location on the same points:" << std::endl;
+    if (!CrossCheckFrozenArrangment(arr, file_points, 1000, 1))
+    {
+        return 1;
+    }
+    std::cout << "The frozen arrangment agrees with CGAL up to its rounding distance." << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    std::cout << "Cross checking the persistent slab point location against the trapezoidal map on the same points:" << std::endl;
+    if (!CrossCheckPersistentSlabPointLocation(arr, file_points, 1000, 1))
+    {
+        return 1;
+    }
+    std::cout << "Both strategies locate every point on the same feature." << std::endl;
+    std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "Memory footprint of the arrangment:" << std::endl;
+    //Arrangement_2D measuredArr;
+    //DisplayArrangmentFootprint(MeasureArrangmentFootprint(file_line_segments, convexHull, measuredArr));
+    //std::unique_ptr<Trapezoid_Point_Location> trapezoidPl;
+    //std::cout << "Trapezoid search structure bytes : " << MeasureSearchStructureBytes(measuredArr, trapezoidPl) << std::endl;
+    //std::unique_ptr<LandMarks_Point_Location> landmarksPl;
+    //std::cout << "Landmarks search structure bytes : " << MeasureSearchStructureBytes(measuredArr, landmarksPl) << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "Displaying faces:" << std::endl;
+    //DisplayFacesOfArrangment(arr);
+    //std::cout << "--------------------------------------------------" << std::endl;
+    
+    //std::cout << "=== Naive Point Location ===" << std::endl;
+    //begin = std::chrono::steady_clock::now();
+    //LocateAndDisplayPointNaive(arr, file_points);
+    //end = std::chrono::steady_clock::now();
+    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+    
+    //std::cout << "=== Walk Along Line Point Location ===" << std::endl;
+    //begin = std::chrono::steady_clock::now();
+    //LocateAndDisplayPointWalkAlongLine(arr, file_points);
+    //end = std::chrono::steady_clock::now();
+    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    
+    //std::cout << "=== Landmarks Point Location ===" << std::endl;
+    //begin = std::chrono::steady_clock::now();
+    //LocateAndDisplayPointLandmarks(arr, file_points);
+    //end = std::chrono::steady_clock::now();
+    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Landmarks Point Location (tuned generator, 50 ms build budget) ===" << std::endl;
+    //Landmark_Tuning tuning = TuneLandmarks(arr, file_points, 0.05);
+    //DisplayLandmarkTuning(tuning);
+    //begin = std::chrono::steady_clock::now();
+    //LocateAndDisplayPointLandmarks(arr, file_points, tuning.generator, tuning.landmarks);
+    //end = std::chrono::steady_clock::now();
+    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+    
+    
+    //std::cout << "=== Trapezoid Point Location ===" << std::endl;
+    //begin = std::chrono::steady_clock::now();
+    //LocateAndDisplayPointTrapezoid(arr, file_points);
+    //end = std::chrono::steady_clock::now();
+    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Persistent Slab Point Location ===" << std::endl;
+    //begin = std::chrono::steady_clock::now();
+    //LocateAndDisplayPointPersistentSlab(arr, file_points);
+    //end = std::chrono::steady_clock::now();
+    //std::cout << "Time difference = " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " miliseconds" << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Trapezoid Point Location (seeded, depth capped at the median of 32 builds) ===" << std::endl;
+    //Trapezoid_Depth_Distribution depths = SampleTrapezoidDepths(arr, true, 1, 32);
+    //DisplayTrapezoidDepthDistribution(depths);
+    //Trapezoid_Options trapezoidOptions = DefaultTrapezoidOptions();
+    //trapezoidOptions.maxQueryPathLength = depths.p50;
+    //Trapezoid_Index trapezoidIndex(arr, trapezoidOptions);
+    //DisplayTrapezoidBuilds(trapezoidIndex);
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Tiled Point Location (4x4 tiles on disk, 16 MB cache) ===" << std::endl;
+    //WriteTiles(file_line_segments, 4, 4, "tiles");
+    //Tiled_Point_Location<Trapezoid_Point_Location> tiled("tiles", 16 << 20);
+    //for (int i = 0; i < file_points.size(); i++)
+    //{
+    //    Tiled_Point_Location<Trapezoid_Point_Location>::Location location = tiled.Locate(file_points[i]);
+    //    displayQueryResult(file_points[i], location.result);
+    //    std::cout << "Face of the full arrangement : " << location.face << std::endl;
+    //}
+    //DisplayTileCacheStats(tiled.Stats());
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Cached Point Location (every point queried twice) ===" << std::endl;
+    //Cached_Point_Location<Trapezoid_Point_Location> cached(arr);
+    //for (int r = 0; r < 2; r++)
+    //{
+    //    for (int i = 0; i < file_points.size(); i++)
+    //    {
+    //        displayQueryResult(file_points[i], cached.Locate(file_points[i]));
+    //    }
+    //}
+    //DisplayQueryCacheStats(cached.Stats());
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Arrangement Compaction (exact evaluation, DAG pruning, double reduction) ===" << std::endl;
+    //Compaction_Report compaction = CompactArrangmentAndMeasure<Trapezoid_Point_Location>(arr, file_points);
+    //DisplayCompactionReport(compaction);
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Overlay of the segment layer and the convex hull layer ===" << std::endl;
+    //Arrangement_2D segmentLayer = BuildArrangmentWithHull(file_line_segments, Vector_Point_2D());
+    //Arrangement_2D hullLayer = BuildArrangmentWithHull(Vector_Line_Segment_2D(), convexHull);
+    //Overlay_Arrangement_2D overlay;
+    //OverlayLayers(segmentLayer, hullLayer, overlay);
+    //DisplayOverlaySummary(overlay);
+    //std::vector<char> boundedA;
+    //for (Arrangement_2D::Face_const_iterator f = segmentLayer.faces_begin(); f != segmentLayer.faces_end(); f++)
+    //{
+    //    boundedA.push_back(!f->is_unbounded());
+    //}
+    //std::vector<char> insideHull;
+    //for (Arrangement_2D::Face_const_iterator f = hullLayer.faces_begin(); f != hullLayer.faces_end(); f++)
+    //{
+    //    insideHull.push_back(!f->is_unbounded());
+    //}
+    //std::vector<char> boundedInsideHull = MergeFaceAttributes(overlay, boundedA, insideHull, [](char a, char b) { return (char)(a && b); });
+    //std::cout << "Bounded segment faces inside the hull : " << std::count(boundedInsideHull.begin(), boundedInsideHull.end(), 1) << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Query time statistics (walk along line) ===" << std::endl;
+    //Instrumented_Point_Location<Walk_Along_Line_Point_Location> instrumented(arr, true);
+    //for (int i = 0; i < file_points.size(); i++)
+    //{
+    //    instrumented.Locate(file_points[i]);
+    //}
+    //DisplayPointLocationStats(instrumented.Stats());
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== First edge above every point (vertical ray shooting) ===" << std::endl;
+    //Arrangement_Index index(arr);
+    //std::vector<Vertical_Ray_Hit> above = ShootVerticalRays(Trapezoid_Point_Location(arr), index, file_points, RAY_UP);
+    //Vertical_Decomposition decomposition = DecomposeArrangment(arr, index);
+    //for (int i = 0; i < file_points.size(); i++)
+    //{
+    //    std::cout << file_points[i] << " : edge " << above[i].edge << ", vertex " << above[i].vertex << std::endl;
+    //}
+    //std::cout << "Trapezoids : " << decomposition.face.size() << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Frozen arrangement (lock free queries on all threads) ===" << std::endl;
+    //Frozen_Arrangement frozen = FreezeArrangment(arr);
+    //std::vector<double> frozenPoints;
+    //for (int i = 0; i < file_points.size(); i++)
+    //{
+    //    frozenPoints.push_back(CGAL::to_double(file_points[i].x()));
+    //    frozenPoints.push_back(CGAL::to_double(file_points[i].y()));
+    //}
+    //std::vector<Frozen_Location> frozenLocations = LocateFrozenParallel(frozen, frozenPoints);
+    //std::cout << "Located : " << frozenLocations.size() << ",  Blob bytes : " << SerializeFrozenArrangment(frozen).size() << std::endl;
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    //std::cout << "=== Window queries (features intersecting a rectangle, on the frozen arrangement above) ===" << std::endl;
+    //Window_Index windowIndex(frozen);
+    //CGAL::Bbox_2 window(0, 0, 100, 100);
+    //DisplayWindowQueryResult(window, windowIndex.Query(window));
+    //std::cout << "--------------------------------------------------" << std::endl;
+
+    if (convexHullFile.valid() && !convexHullFile.get())
+    {
+        std::cout << "Unable to write 'convexHull.txt'." << std::endl;
+        return 1;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+// Linker to Header File
+#include "MemoryFootprint.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Input stream class to operate on files.
+// * https://www.cplusplus.com/reference/fstream/ifstream/
+#include <fstream>
+
+// glibc heap statistics (mallinfo / mallinfo2).
+// https://man7.org/linux/man-pages/man3/mallinfo.3.html
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// sysconf(_SC_PAGESIZE), the size of the pages counted by /proc/self/statm.
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace
+{
+	typedef Arrangement_2D::Dcel Dcel;
+}
+
+size_t CurrentHeapBytes()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+	// Bytes in use by malloc, in the arenas (uordblks) and in separately mmapped blocks (hblkhd).
+	struct mallinfo2 info = mallinfo2();
+	return info.uordblks + info.hblkhd;
+#elif defined(__GLIBC__)
+	// mallinfo reports int fields, which wrap above 2 GB.
+	struct mallinfo info = mallinfo();
+	return (size_t)(unsigned int)info.uordblks + (size_t)(unsigned int)info.hblkhd;
+#else
+	return 0;
+#endif
+}
+
+bool HeapMeasurementSupported()
+{
+#if defined(__GLIBC__)
+	return true;
+#else
+	return false;
+#endif
+}
+
+size_t CurrentResidentBytes()
+{
+#if defined(__linux__)
+	// /proc/self/statm holds the total and the resident number of pages.
+	// https://man7.org/linux/man-pages/man5/proc.5.html
+	std::ifstream statm("/proc/self/statm");
+	size_t totalPages;
+	size_t residentPages;
+	if (statm >> totalPages >> residentPages)
+	{
+		return residentPages * (size_t)sysconf(_SC_PAGESIZE);
+	}
+#endif
+	return 0;
+}
+
+void ReleaseFreeHeapMemory()
+{
+#if defined(__GLIBC__)
+	malloc_trim(0);
+#endif
+}
+
+Arrangement_Footprint ArrangmentFootprint(const Arrangement_2D& arr)
+{
+	Arrangement_Footprint footprint;
+	footprint.vertices = arr.number_of_vertices();
+	footprint.halfedges = arr.number_of_halfedges();
+	footprint.faces = arr.number_of_faces();
+
+	// Every vertex owns a point and every pair of twin halfedges owns one curve; both are allocated apart from the records.
+	footprint.bytesPerVertex = sizeof(Arrangement_2D::Vertex) + sizeof(Arrangement_2D::Point_2);
+	footprint.bytesPerHalfedge = sizeof(Arrangement_2D::Halfedge);
+	footprint.bytesPerEdgeCurve = sizeof(Arrangement_2D::X_monotone_curve_2);
+	footprint.bytesPerFace = sizeof(Arrangement_2D::Face);
+	footprint.bytesPerCcb = std::max(sizeof(Dcel::Outer_ccb), sizeof(Dcel::Inner_ccb));
+
+	size_t nrOfOuterCcbs = 0;
+	size_t nrOfInnerCcbs = 0;
+	for (Arrangement_2D::Face_const_iterator f = arr.faces_begin(); f != arr.faces_end(); f++)
+	{
+		nrOfOuterCcbs += f->number_of_outer_ccbs();
+		nrOfInnerCcbs += f->number_of_inner_ccbs();
+	}
+
+	footprint.dcelBytes = footprint.vertices * footprint.bytesPerVertex
+		+ footprint.halfedges * footprint.bytesPerHalfedge
+		+ arr.number_of_edges() * footprint.bytesPerEdgeCurve
+		+ footprint.faces * footprint.bytesPerFace
+		+ nrOfOuterCcbs * sizeof(Dcel::Outer_ccb)
+		+ nrOfInnerCcbs * sizeof(Dcel::Inner_ccb)
+		+ arr.number_of_isolated_vertices() * sizeof(Dcel::Isolated_vertex);
+	footprint.heapBytes = 0;
+	footprint.otherHeapBytes = 0;
+	return footprint;
+}
+
+Arrangement_Footprint MeasureArrangmentFootprint(const Vector_Line_Segment_2D& segmentVector, const Vector_Point_2D& convexHull, Arrangement_2D& arr)
+{
+	arr.clear();
+	size_t before = CurrentHeapBytes();
+	// Built in place: a copy assignment would allocate a second DCEL inside the measured window.
+	BuildArrangmentWithHull(segmentVector, convexHull, arr);
+	size_t after = CurrentHeapBytes();
+
+	Arrangement_Footprint footprint = ArrangmentFootprint(arr);
+	footprint.heapBytes = after > before ? after - before : 0;
+	footprint.otherHeapBytes = footprint.heapBytes > footprint.dcelBytes ? footprint.heapBytes - footprint.dcelBytes : 0;
+	return footprint;
+}
+
+void DisplayArrangmentFootprint(const Arrangement_Footprint& footprint)
+{
+	std::cout << "Vertices : " << footprint.vertices
+		<< ",  Halfedges : " << footprint.halfedges
+		<< ",  Faces : " << footprint.faces << std::endl;
+	std::cout << "Bytes per vertex (record + point) : " << footprint.bytesPerVertex << std::endl
+		<< "Bytes per halfedge : " << footprint.bytesPerHalfedge << " (+ " << footprint.bytesPerEdgeCurve << " per edge curve)" << std::endl
+		<< "Bytes per face : " << footprint.bytesPerFace << " (+ " << footprint.bytesPerCcb << " per CCB)" << std::endl
+		<< "DCEL bytes : " << footprint.dcelBytes << std::endl;
+	if (footprint.heapBytes > 0)
+	{
+		std::cout << "Heap bytes : " << footprint.heapBytes
+			<< " (lazy exact numbers and allocator overhead : " << footprint.otherHeapBytes << ")" << std::endl;
+		if (footprint.halfedges > 0)
+		{
+			std::cout << "Heap bytes per edge : " << 2 * footprint.heapBytes / footprint.halfedges << std::endl;
+		}
+	}
+}
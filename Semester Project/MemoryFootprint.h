@@ -0,0 +1,97 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+#ifndef MEMORY_FOOTPRINT_H
+#define MEMORY_FOOTPRINT_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// * Header that defines smart pointers (std::unique_ptr) for dynamic memory management.
+// * https://www.cplusplus.com/reference/memory/
+#include <memory>
+
+/*
+* The memory used by an arrangement. The per record sizes come from the DCEL types: a vertex record plus its point,
+* a halfedge record (two per edge, sharing one x - monotone curve), a face record plus its outer and inner CCB records.
+* dcelBytes is the sum of these records. The points and curves only hold handles to lazy exact numbers: the numbers
+* themselves (interval approximations, construction DAG nodes and, once computed, exact values) are measured as the
+* rest of the heap growth, otherHeapBytes = heapBytes - dcelBytes, which also includes the allocator overhead. Numbers
+* shared with the input (the segment end points already allocated by the caller) are not part of the growth.
+* The heap figures are 0 when the arrangement was not built under MeasureArrangmentFootprint or the heap cannot be measured.
+*/
+struct Arrangement_Footprint
+{
+	size_t vertices;
+	size_t halfedges;
+	size_t faces;
+
+	size_t bytesPerVertex;
+	size_t bytesPerHalfedge;
+	size_t bytesPerEdgeCurve;
+	size_t bytesPerFace;
+	size_t bytesPerCcb;
+
+	size_t dcelBytes;
+	size_t heapBytes;
+	size_t otherHeapBytes;
+};
+
+/*
+* This function is responsible for returning the number of bytes currently allocated on the heap (by malloc and new),
+* or 0 if the C library gives no way of measuring it (only glibc is supported). It is a process wide figure, so the
+* differences taken by the functions below are only meaningful while no other thread allocates.
+*/
+size_t CurrentHeapBytes();
+
+/*
+* Returns true if CurrentHeapBytes can measure the heap on this platform.
+*/
+bool HeapMeasurementSupported();
+
+/*
+* This function is responsible for returning the resident set size of the process (the memory pages it holds), or 0 if
+* it cannot be read (only Linux, through /proc/self/statm, is supported). Freed heap memory is usually kept by malloc,
+* so the resident size only drops after ReleaseFreeHeapMemory.
+*/
+size_t CurrentResidentBytes();
+
+/*
+* This function is responsible for returning the free memory of the malloc arenas to the operating system (glibc only;
+* elsewhere it does nothing).
+*/
+void ReleaseFreeHeapMemory();
+
+/*
+* This function is responsible for computing the DCEL part of the footprint of the given arrangment, from its record
+* counts and the sizes of the record types. The heap figures are left 0.
+*/
+Arrangement_Footprint ArrangmentFootprint(const Arrangement_2D& arr);
+
+/*
+* This function is responsible for building, into arr and in place, the arrangment of the given segments and convex hull
+* (as BuildArrangmentWithHull) while measuring the heap growth, and returning its full footprint.
+*/
+Arrangement_Footprint MeasureArrangmentFootprint(const Vector_Line_Segment_2D& segmentVector, const Vector_Point_2D& convexHull, Arrangement_2D& arr);
+
+/*
+* This function is responsible for attaching a new point location object of the given strategy to the given arrangment,
+* into pl, and returning the heap growth it caused: the size of the search structure (landmark kd - tree, trapezoidal
+* map search DAG, ...). Naive and walk along line strategies keep no structure, so their size is only the object itself.
+* Example: std::unique_ptr<Trapezoid_Point_Location> pl; size_t bytes = MeasureSearchStructureBytes(arr, pl);
+*/
+template <class Strategy>
+size_t MeasureSearchStructureBytes(const Arrangement_2D& arr, std::unique_ptr<Strategy>& pl)
+{
+	pl.reset();
+	size_t before = CurrentHeapBytes();
+	pl.reset(new Strategy(arr));
+	size_t after = CurrentHeapBytes();
+	return after > before ? after - before : 0;
+}
+
+/*
+* This function is responsible for displaying the given footprint to the screen.
+*/
+void DisplayArrangmentFootprint(const Arrangement_Footprint& footprint);
+#endif
@@ -0,0 +1,354 @@
+// Linker to Header File
+#include "PersistentSlabPointLocation.h"
+
+// Linker to Vertical Decomposition Header File (Arrangement_Index, to number the edges)
+#include "VerticalDecomposition.h"
+
+// Linker to Trapezoid Index Header File (seeded trapezoidal map, the reference of the cross check)
+#include "TrapezoidIndex.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that introduces random number generation facilities (std::mt19937, for the random query points).
+// * https://www.cplusplus.com/reference/random/
+#include <random>
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+Persistent_Slab_Point_Location::Persistent_Slab_Point_Location(const Arrangement_2D& arr) : arr(arr)
+{
+	Arrangement_Index index(arr);
+
+	// Every edge from its lexicographically smaller end point: from left to right, or upwards for a vertical edge.
+	edges.resize(index.NumberOfEdges());
+	for (int e = 0; e < edges.size(); e++)
+	{
+		edges[e] = index.Edge(e);
+		if (CGAL::compare_xy(edges[e]->source()->point(), edges[e]->target()->point()) == CGAL::LARGER)
+		{
+			edges[e] = edges[e]->twin();
+		}
+	}
+
+	std::vector<Vertex_handle> vertices(index.NumberOfVertices());
+	for (int v = 0; v < vertices.size(); v++)
+	{
+		vertices[v] = index.Vertex(v);
+	}
+	std::sort(vertices.begin(), vertices.end(), [](Vertex_handle a, Vertex_handle b)
+	{
+		return CGAL::compare_xy(a->point(), b->point()) == CGAL::SMALLER;
+	});
+	columnVertices = vertices;
+	columnUpEdge.assign(vertices.size(), -1);
+
+	// The sweep: at every vertical line, the edges ending there leave the status, then the edges starting there enter it.
+	int root = -1;
+	std::vector<int> ending;
+	std::vector<int> starting;
+	for (size_t first = 0; first < vertices.size();)
+	{
+		size_t last = first + 1;
+		while (last < vertices.size() && CGAL::compare_x(vertices[first]->point(), vertices[last]->point()) == CGAL::EQUAL)
+		{
+			last++;
+		}
+		ending.clear();
+		starting.clear();
+		for (size_t i = first; i < last; i++)
+		{
+			if (vertices[i]->is_isolated())
+			{
+				continue;
+			}
+			Arrangement_2D::Halfedge_around_vertex_const_circulator current = vertices[i]->incident_halfedges();
+			Arrangement_2D::Halfedge_around_vertex_const_circulator end = current;
+			do
+			{
+				int e = index.EdgeIndex(current);
+				CGAL::Comparison_result side = CGAL::compare_x(current->source()->point(), vertices[i]->point());
+				if (side == CGAL::SMALLER)
+				{
+					ending.push_back(e);
+				}
+				else if (side == CGAL::LARGER)
+				{
+					starting.push_back(e);
+				}
+				else if (CGAL::compare_y(current->source()->point(), vertices[i]->point()) == CGAL::LARGER)
+				{
+					columnUpEdge[i] = e;
+				}
+			} while (++current != end);
+		}
+		for (size_t k = 0; k < ending.size(); k++)
+		{
+			root = Remove(root, ending[k]);
+		}
+		for (size_t k = 0; k < starting.size(); k++)
+		{
+			root = Insert(root, starting[k]);
+		}
+		columnOffsets.push_back((int)first);
+		roots.push_back(root);
+		first = last;
+	}
+	columnOffsets.push_back((int)vertices.size());
+}
+
+Location_Result_Type Persistent_Slab_Point_Location::locate(const Point_2D& point) const
+{
+	// The first vertical line that is not to the left of the point.
+	size_t first = 0;
+	size_t count = roots.size();
+	while (count > 0)
+	{
+		size_t step = count / 2;
+		if (CGAL::compare_x(columnVertices[columnOffsets[first + step]]->point(), point) == CGAL::SMALLER)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	int root = first == 0 ? -1 : roots[first - 1];
+	if (first < roots.size() && CGAL::compare_x(columnVertices[columnOffsets[first]]->point(), point) == CGAL::EQUAL)
+	{
+		// On a vertical line: one of its vertices, a vertical edge between two of them, or the slab to its right.
+		std::vector<Vertex_handle>::const_iterator begin = columnVertices.begin() + columnOffsets[first];
+		std::vector<Vertex_handle>::const_iterator end = columnVertices.begin() + columnOffsets[first + 1];
+		int above = (int)(std::partition_point(begin, end, [&point](Vertex_handle v) { return CGAL::compare_y(v->point(), point) == CGAL::SMALLER; }) - columnVertices.begin());
+		if (above < columnOffsets[first + 1] && CGAL::compare_y(columnVertices[above]->point(), point) == CGAL::EQUAL)
+		{
+			return Location_Result_Type(columnVertices[above]);
+		}
+		if (above > columnOffsets[first] && columnUpEdge[above - 1] != -1)
+		{
+			return Location_Result_Type(edges[columnUpEdge[above - 1]]);
+		}
+		root = roots[first];
+	}
+
+	// The highest edge of the slab below the point; the face above it (to the left of its halfedge) contains the point.
+	int below = -1;
+	for (int node = root; node != -1;)
+	{
+		CGAL::Comparison_result side = CompareToEdge(point, nodes[node].edge);
+		if (side == CGAL::EQUAL)
+		{
+			return Location_Result_Type(edges[nodes[node].edge]);
+		}
+		if (side == CGAL::LARGER)
+		{
+			below = nodes[node].edge;
+			node = nodes[node].right;
+		}
+		else
+		{
+			node = nodes[node].left;
+		}
+	}
+	return below == -1 ? Location_Result_Type(arr.unbounded_face()) : Location_Result_Type(edges[below]->face());
+}
+
+size_t Persistent_Slab_Point_Location::NumberOfSlabs() const
+{
+	return roots.size();
+}
+
+size_t Persistent_Slab_Point_Location::NumberOfNodes() const
+{
+	return nodes.size();
+}
+
+int Persistent_Slab_Point_Location::Height() const
+{
+	int height = 0;
+	for (size_t k = 0; k < roots.size(); k++)
+	{
+		height = std::max(height, NodeHeight(roots[k]));
+	}
+	return height;
+}
+
+CGAL::Comparison_result Persistent_Slab_Point_Location::CompareToEdge(const Point_2D& point, int edge) const
+{
+	// Compare_y_at_x_2
+	// Compares the y coordinate of a point with the curve at the x coordinate of the point.
+	// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classArrTraits_1_1CompareYAtX__2.html
+	return arr.geometry_traits()->compare_y_at_x_2_object()(point, edges[edge]->curve());
+}
+
+bool Persistent_Slab_Point_Location::IsBelow(int node, int edge, bool atRightEndPoint) const
+{
+	int other = nodes[node].edge;
+	const Point_2D& point = atRightEndPoint ? edges[edge]->target()->point() : edges[edge]->source()->point();
+	CGAL::Comparison_result side = CompareToEdge(point, other);
+	if (side == CGAL::EQUAL)
+	{
+		// Both edges share the end point: compare them right after it (or right before it).
+		// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classArrTraits_1_1CompareYAtXRight__2.html
+		side = atRightEndPoint
+			? arr.geometry_traits()->compare_y_at_x_left_2_object()(edges[edge]->curve(), edges[other]->curve(), point)
+			: arr.geometry_traits()->compare_y_at_x_right_2_object()(edges[edge]->curve(), edges[other]->curve(), point);
+	}
+	return side == CGAL::LARGER;
+}
+
+int Persistent_Slab_Point_Location::NodeHeight(int node) const
+{
+	return node == -1 ? 0 : nodes[node].height;
+}
+
+int Persistent_Slab_Point_Location::NewNode(int edge, int left, int right)
+{
+	nodes.push_back(Slab_Node{ edge, left, right, 1 + std::max(NodeHeight(left), NodeHeight(right)) });
+	return (int)nodes.size() - 1;
+}
+
+int Persistent_Slab_Point_Location::Balance(int edge, int left, int right)
+{
+	// The heights of left and right differ by at most 2: copy the one or two nodes of the single or double rotation.
+	if (NodeHeight(left) > NodeHeight(right) + 1)
+	{
+		Slab_Node lower = nodes[left];
+		if (NodeHeight(lower.left) >= NodeHeight(lower.right))
+		{
+			return NewNode(lower.edge, lower.left, NewNode(edge, lower.right, right));
+		}
+		Slab_Node middle = nodes[lower.right];
+		return NewNode(middle.edge, NewNode(lower.edge, lower.left, middle.left), NewNode(edge, middle.right, right));
+	}
+	if (NodeHeight(right) > NodeHeight(left) + 1)
+	{
+		Slab_Node upper = nodes[right];
+		if (NodeHeight(upper.right) >= NodeHeight(upper.left))
+		{
+			return NewNode(upper.edge, NewNode(edge, left, upper.left), upper.right);
+		}
+		Slab_Node middle = nodes[upper.left];
+		return NewNode(middle.edge, NewNode(edge, left, middle.left), NewNode(upper.edge, middle.right, upper.right));
+	}
+	return NewNode(edge, left, right);
+}
+
+int Persistent_Slab_Point_Location::Insert(int root, int edge)
+{
+	if (root == -1)
+	{
+		return NewNode(edge, -1, -1);
+	}
+	Slab_Node node = nodes[root];
+	if (IsBelow(root, edge, false))
+	{
+		int right = Insert(node.right, edge);
+		return Balance(node.edge, node.left, right);
+	}
+	int left = Insert(node.left, edge);
+	return Balance(node.edge, left, node.right);
+}
+
+int Persistent_Slab_Point_Location::Remove(int root, int edge)
+{
+	if (root == -1)
+	{
+		return -1;
+	}
+	Slab_Node node = nodes[root];
+	if (node.edge == edge)
+	{
+		if (node.left == -1 || node.right == -1)
+		{
+			return node.left == -1 ? node.right : node.left;
+		}
+		int lowest;
+		int right = RemoveLowest(node.right, lowest);
+		return Balance(lowest, node.left, right);
+	}
+	if (IsBelow(root, edge, true))
+	{
+		int right = Remove(node.right, edge);
+		return Balance(node.edge, node.left, right);
+	}
+	int left = Remove(node.left, edge);
+	return Balance(node.edge, left, node.right);
+}
+
+int Persistent_Slab_Point_Location::RemoveLowest(int root, int& lowest)
+{
+	Slab_Node node = nodes[root];
+	if (node.left == -1)
+	{
+		lowest = node.edge;
+		return node.right;
+	}
+	int left = RemoveLowest(node.left, lowest);
+	return Balance(node.edge, left, node.right);
+}
+
+void LocateAndDisplayPointPersistentSlab(const Arrangement_2D& arr, const Vector_Point_2D& points)
+{
+	Persistent_Slab_Point_Location slab_pl(arr);
+	Location_Result_Type Point_Location_Result_Object;
+	for (int i = 0; i < points.size(); i++)
+	{
+		Point_Location_Result_Object = slab_pl.locate(points[i]);
+		displayQueryResult(points[i], Point_Location_Result_Object);
+	}
+}
+
+bool CrossCheckPersistentSlabPointLocation(const Arrangement_2D& arr, const Vector_Point_2D& points, int nrOfRandomPoints, unsigned int seed)
+{
+	Vector_Point_2D queries = points;
+	if (arr.number_of_vertices() > 0)
+	{
+		CGAL::Bbox_2 box = arr.vertices_begin()->point().bbox();
+		for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+		{
+			box = box + v->point().bbox();
+			queries.push_back(v->point());
+		}
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<double> x(box.xmin(), box.xmax());
+		std::uniform_real_distribution<double> y(box.ymin(), box.ymax());
+		for (int i = 0; i < nrOfRandomPoints; i++)
+		{
+			queries.push_back(Point_2D(x(generator), y(generator)));
+		}
+	}
+	for (Arrangement_2D::Edge_const_iterator e = arr.edges_begin(); e != arr.edges_end(); e++)
+	{
+		queries.push_back(CGAL::midpoint(e->source()->point(), e->target()->point()));
+	}
+
+	Arrangement_Index index(arr);
+	Persistent_Slab_Point_Location slab_pl(arr);
+	Trapezoid_Point_Location trapezoid_pl;
+	AttachTrapezoidPointLocation(trapezoid_pl, arr, true, seed);
+	if (slab_pl.Height() > 1.4405 * std::log2(arr.number_of_edges() + 2.0))
+	{
+		std::cout << "The persistent slab tree of " << arr.number_of_edges() << " edges has height " << slab_pl.Height() << std::endl;
+		return false;
+	}
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		Vertical_Ray_Hit a = MakeVerticalRayHit(index, slab_pl.locate(queries[i]));
+		Vertical_Ray_Hit b = MakeVerticalRayHit(index, trapezoid_pl.locate(queries[i]));
+		if (a.vertex != b.vertex || a.edge != b.edge || a.face != b.face)
+		{
+			std::cout << "The persistent slabs locate the point " << i << " (" << CGAL::to_double(queries[i].x()) << ", "
+				<< CGAL::to_double(queries[i].y()) << ") on vertex " << a.vertex << ", edge " << a.edge << ", face " << a.face
+				<< ", the trapezoidal map on vertex " << b.vertex << ", edge " << b.edge << ", face " << b.face << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
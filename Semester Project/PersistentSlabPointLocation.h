@@ -0,0 +1,96 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Slab point location with a persistent search tree (Sarnak and Tarjan, "Planar point location using persistent search
+// trees", 1986): one sweep from left to right records every version of the sweep line status.
+
+#ifndef PERSISTENT_SLAB_POINT_LOCATION_H
+#define PERSISTENT_SLAB_POINT_LOCATION_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// --------------------------------------------------------------------
+
+/*
+* This class is responsible for a fifth point location strategy, next to the four of CGAL, for static arrangements.
+* The vertical lines through the vertices split the plane into slabs; inside a slab the edges do not cross, so they are
+* totally ordered from bottom to top. A sweep from left to right keeps this order in a balanced (AVL) binary tree; every
+* update copies the path it changes and the nodes it rotates (path copying), so the tree of every slab stays available,
+* sharing its unchanged subtrees with its neighbours. A query finds its slab by a binary search over the vertex x
+* coordinates, then descends the tree of the slab, whose height is at most 1.44 log2(n + 2): O(log n) worst case time with
+* exact predicates, O(n log n) preprocessing time and memory.
+* It has the interface of the CGAL strategies used in this project (constructed on an arrangement, locate), but is not
+* attached to the arrangement: it must be rebuilt after the arrangement changes, and it may be queried from several
+* threads at the same time, as long as the lazy exact numbers of the arrangement are not evaluated concurrently.
+*/
+class Persistent_Slab_Point_Location
+{
+public:
+	Persistent_Slab_Point_Location(const Arrangement_2D& arr);
+
+	/*
+	* The vertex, the halfedge (the one directed from left to right, or upwards for a vertical edge) or the face that
+	* contains the given point.
+	*/
+	Location_Result_Type locate(const Point_2D& point) const;
+
+	/*
+	* Number of slabs (the distinct x coordinates of the vertices), number of tree nodes of all the versions and height of
+	* the highest version.
+	*/
+	size_t NumberOfSlabs() const;
+	size_t NumberOfNodes() const;
+	int Height() const;
+
+private:
+	struct Slab_Node
+	{
+		int edge;
+		int left;
+		int right;
+		int height;
+	};
+
+	// The position of the given point relative to the given non vertical edge, at the x of the point: LARGER above it.
+	CGAL::Comparison_result CompareToEdge(const Point_2D& point, int edge) const;
+
+	// Whether the edge of the given node, another edge, is below the given edge, at its left end point (where it is
+	// inserted) or at its right end point (where it is removed).
+	bool IsBelow(int node, int edge, bool atRightEndPoint) const;
+
+	// Path copying AVL updates: every function returns the root of a new version and leaves the given one unchanged.
+	int NodeHeight(int node) const;
+	int NewNode(int edge, int left, int right);
+	int Balance(int edge, int left, int right);
+	int Insert(int root, int edge);
+	int Remove(int root, int edge);
+	int RemoveLowest(int root, int& lowest);
+
+	const Arrangement_2D& arr;
+	std::vector<HalfEdge_handle> edges;
+	std::vector<Slab_Node> nodes;
+
+	// columns[k] is a vertex on the k-th vertical line; its vertices, from bottom to top, are
+	// columnVertices[columnOffsets[k] .. columnOffsets[k+1]), with the vertical edge going up from each (-1 if none).
+	// roots[k] is the tree of the slab to the right of the k-th line (-1 when empty).
+	std::vector<Vertex_handle> columnVertices;
+	std::vector<int> columnUpEdge;
+	std::vector<int> columnOffsets;
+	std::vector<int> roots;
+};
+
+/*
+* This function is responsible for performing a series of point location querys on the given points vector.
+* The algorithmic approach used is: Persistent_Slab_Point_Location
+*/
+void LocateAndDisplayPointPersistentSlab(const Arrangement_2D& arr, const Vector_Point_2D& points);
+
+/*
+* This function is responsible for cross checking Persistent_Slab_Point_Location against Trapezoid_Point_Location (built
+* with the given seed) on the given points, on nrOfRandomPoints points drawn with the given seed over the bounding box of
+* the vertices, and on the vertices and the edge midpoints of the arrangment. Returns false, and displays the first
+* mismatch, if they ever locate a point on different features.
+*/
+bool CrossCheckPersistentSlabPointLocation(const Arrangement_2D& arr, const Vector_Point_2D& points, int nrOfRandomPoints, unsigned int seed);
+#endif
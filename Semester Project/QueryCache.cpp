@@ -0,0 +1,83 @@
+// Linker to Header File
+#include "QueryCache.h"
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// * Header that declares std::memcpy, used to read the bit pattern of a double.
+// * https://www.cplusplus.com/reference/cstring/memcpy/
+#include <cstring>
+
+namespace
+{
+	// 2^51: the grid cells of a coordinate are the integers in (-2^51, 2^51). Beyond them the doubles are more than a
+	// quarter of a cell apart, so the grid hardly merges any coordinates and the exact key is used instead.
+	const double Cell_Limit = 2251799813685248.0;
+
+	// A cell c is stored as the bit pattern of a NaN, 0x7FF0000000000000 + 2^51 + c, which no exact key can have.
+	unsigned long long CellBits(double cell)
+	{
+		return 0x7FF0000000000000ull + (unsigned long long)((long long)cell + (1ll << 51));
+	}
+
+	unsigned long long DoubleBits(double value)
+	{
+		// -0.0 and 0.0 are the same coordinate; adding 0.0 turns the former into the latter.
+		value += 0.0;
+		unsigned long long bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+}
+
+Query_Cache_Options DefaultQueryCacheOptions()
+{
+	Query_Cache_Options options;
+	options.capacity = 1 << 16;
+	options.tolerance = 0;
+	options.shards = 16;
+	return options;
+}
+
+bool MakeQueryCacheKey(const Point_2D& point, double tolerance, Query_Cache_Key& key)
+{
+	if (tolerance > 0)
+	{
+		double cellX = std::floor(CGAL::to_double(point.x()) / tolerance);
+		double cellY = std::floor(CGAL::to_double(point.y()) / tolerance);
+		if (std::abs(cellX) < Cell_Limit && std::abs(cellY) < Cell_Limit)
+		{
+			key.x = CellBits(cellX);
+			key.y = CellBits(cellY);
+			return true;
+		}
+	}
+
+	// CGAL::to_interval
+	// Returns the interval approximation of a number; it is a single double if and only if the number is a double.
+	// https://doc.cgal.org/5.0.4/Algebraic_foundations/group__PkgAlgebraicFoundationsRef.html
+	std::pair<double, double> intervalX = CGAL::to_interval(point.x());
+	std::pair<double, double> intervalY = CGAL::to_interval(point.y());
+	if (intervalX.first != intervalX.second || intervalY.first != intervalY.second)
+	{
+		return false;
+	}
+	key.x = DoubleBits(intervalX.first);
+	key.y = DoubleBits(intervalY.first);
+	return true;
+}
+
+void DisplayQueryCacheStats(const Query_Cache_Stats& stats)
+{
+	size_t queries = stats.hits + stats.misses + stats.bypasses;
+	double hitRate = queries == 0 ? 0 : (double)stats.hits / queries;
+	std::cout << "Queries : " << queries
+		<< ",  Hits : " << stats.hits
+		<< ",  Misses : " << stats.misses
+		<< ",  Bypasses : " << stats.bypasses
+		<< std::fixed << std::setprecision(2) << " (hit rate " << 100 * hitRate << "%)" << std::endl;
+	std::cout << "Entries : " << stats.entries
+		<< ",  Evictions : " << stats.evictions
+		<< ",  Invalidations : " << stats.invalidations << std::endl;
+}
@@ -0,0 +1,255 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Result cache in front of a point location strategy, for query streams that repeat the same coordinates.
+
+#ifndef QUERY_CACHE_H
+#define QUERY_CACHE_H
+
+// Linker to Face Cache Header File (Arrangement_Observer, point location typedefs)
+#include "FaceCache.h"
+
+// * Lists are sequence containers that allow constant time insert and erase operations anywhere within the sequence.
+// * https://www.cplusplus.com/reference/list/list/
+#include <list>
+
+// * Header that defines the std::mutex and std::lock_guard synchronization primitives.
+// * https://www.cplusplus.com/reference/mutex/
+#include <mutex>
+
+// * Header that defines atomic types, which can be accessed from several threads without data races.
+// * https://www.cplusplus.com/reference/atomic/
+#include <atomic>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// --------------------------------------------------------------------
+
+/*
+* Options of a query cache.
+* capacity: maximum number of cached results, over all the shards (about 100 bytes each).
+* tolerance: 0 for exact mode, where a result is reused only for the very same coordinates. A positive tolerance enables
+* approximate mode: the plane is snapped to a grid of tolerance x tolerance cells and every query of a cell gets the
+* result of the first query of that cell, which is wrong near the edges and vertices crossing the cell.
+* shards: number of independently locked parts of the cache, so concurrent queries rarely wait on each other.
+*/
+struct Query_Cache_Options
+{
+	size_t capacity;
+	double tolerance;
+	unsigned int shards;
+};
+
+/*
+* This function is responsible for returning the default options: 65536 results, exact mode, 16 shards.
+*/
+Query_Cache_Options DefaultQueryCacheOptions();
+
+/*
+* The key of a query: the bit patterns of its double coordinates (exact mode) or its grid cell (approximate mode), stored
+* as the bit pattern of a NaN so that both kinds of keys never collide.
+*/
+struct Query_Cache_Key
+{
+	unsigned long long x;
+	unsigned long long y;
+
+	bool operator==(const Query_Cache_Key& other) const
+	{
+		return x == other.x && y == other.y;
+	}
+};
+
+struct Query_Cache_Key_Hash
+{
+	size_t operator()(const Query_Cache_Key& key) const
+	{
+		// Double bit patterns of round coordinates end in zeros, so the bits are mixed (splitmix64 finalizer) before the
+		// hash is reduced to a shard and a bucket.
+		unsigned long long h = key.x * 0x9E3779B97F4A7C15ull ^ key.y;
+		h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+		h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+		return (size_t)(h ^ (h >> 31));
+	}
+};
+
+/*
+* This function is responsible for computing the key of the given point. It returns false if the point cannot be cached:
+* in exact mode, a point whose coordinates are not doubles (an intersection point, say) has no exact double key. In
+* approximate mode, a point whose grid cell index is 2^51 or more in magnitude gets its exact key instead.
+*/
+bool MakeQueryCacheKey(const Point_2D& point, double tolerance, Query_Cache_Key& key);
+
+/*
+* Counters of a query cache. bypasses are the queries that could not be cached (see MakeQueryCacheKey); invalidations
+* count the arrangement changes that emptied the cache.
+*/
+struct Query_Cache_Stats
+{
+	size_t hits;
+	size_t misses;
+	size_t bypasses;
+	size_t evictions;
+	size_t invalidations;
+	size_t entries;
+};
+
+/*
+* This function is responsible for displaying the given cache counters to the screen.
+*/
+void DisplayQueryCacheStats(const Query_Cache_Stats& stats);
+
+/*
+* This class is responsible for caching the results of a point location strategy (any of the four CGAL strategies) on
+* the given arrangment. Results are kept per shard in least recently used order, up to the capacity. The cache observes
+* the arrangement: any change empties it, since the cached handles and answers may no longer be valid.
+* Locate may be called from several threads. Cache hits only lock their shard; misses run the strategy one at a time,
+* because locating evaluates lazy exact numbers, which is not thread safe. The arrangement must not change while queries
+* are running.
+* Example: Cached_Point_Location<Trapezoid_Point_Location> cached(arr); cached.Locate(point);
+*/
+template <class Strategy>
+class Cached_Point_Location : public Arrangement_Observer
+{
+public:
+	Cached_Point_Location(Arrangement_2D& arr, const Query_Cache_Options& options = DefaultQueryCacheOptions())
+		: Arrangement_Observer(arr), pl(arr), options(options), shards(std::max(1u, options.shards)),
+		hits(0), misses(0), bypasses(0), evictions(0), invalidations(0)
+	{
+		shardCapacity = std::max<size_t>(1, (options.capacity + shards.size() - 1) / shards.size());
+	}
+
+	Location_Result_Type Locate(const Point_2D& point)
+	{
+		Query_Cache_Key key;
+		if (!MakeQueryCacheKey(point, options.tolerance, key))
+		{
+			bypasses++;
+			std::lock_guard<std::mutex> lock(locateMutex);
+			return pl.locate(point);
+		}
+
+		Shard& shard = shards[Query_Cache_Key_Hash()(key) % shards.size()];
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+			typename Shard::Index::iterator found = shard.index.find(key);
+			if (found != shard.index.end())
+			{
+				hits++;
+				shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+				return found->second->second;
+			}
+		}
+
+		misses++;
+		Location_Result_Type result;
+		{
+			std::lock_guard<std::mutex> lock(locateMutex);
+			result = pl.locate(point);
+		}
+
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		if (shard.index.find(key) == shard.index.end())
+		{
+			shard.lru.push_front(Entry(key, result));
+			shard.index[key] = shard.lru.begin();
+			if (shard.lru.size() > shardCapacity)
+			{
+				shard.index.erase(shard.lru.back().first);
+				shard.lru.pop_back();
+				evictions++;
+			}
+		}
+		return result;
+	}
+
+	/*
+	* Drops every cached result.
+	*/
+	void Clear()
+	{
+		for (size_t s = 0; s < shards.size(); s++)
+		{
+			std::lock_guard<std::mutex> lock(shards[s].mutex);
+			shards[s].index.clear();
+			shards[s].lru.clear();
+		}
+	}
+
+	Query_Cache_Stats Stats() const
+	{
+		Query_Cache_Stats stats;
+		stats.hits = hits;
+		stats.misses = misses;
+		stats.bypasses = bypasses;
+		stats.evictions = evictions;
+		stats.invalidations = invalidations;
+		stats.entries = 0;
+		for (size_t s = 0; s < shards.size(); s++)
+		{
+			std::lock_guard<std::mutex> lock(shards[s].mutex);
+			stats.entries += shards[s].lru.size();
+		}
+		return stats;
+	}
+
+	/*
+	* The underlying CGAL point location object.
+	*/
+	const Strategy& PointLocation() const
+	{
+		return pl;
+	}
+
+	// Arrangement_Observer notifications: every structural change empties the cache.
+	virtual void after_attach() { Invalidate(); }
+	virtual void before_detach() { Invalidate(); }
+	virtual void after_assign() { Invalidate(); }
+	virtual void after_clear() { Invalidate(); }
+	virtual void after_global_change() { Invalidate(); }
+	virtual void after_create_vertex(Arrangement_2D::Vertex_handle) { Invalidate(); }
+	virtual void after_create_edge(Arrangement_2D::Halfedge_handle) { Invalidate(); }
+	virtual void after_modify_vertex(Arrangement_2D::Vertex_handle) { Invalidate(); }
+	virtual void after_modify_edge(Arrangement_2D::Halfedge_handle) { Invalidate(); }
+	virtual void after_split_edge(Arrangement_2D::Halfedge_handle, Arrangement_2D::Halfedge_handle) { Invalidate(); }
+	virtual void after_split_face(Arrangement_2D::Face_handle, Arrangement_2D::Face_handle, bool) { Invalidate(); }
+	virtual void after_merge_edge(Arrangement_2D::Halfedge_handle) { Invalidate(); }
+	virtual void after_merge_face(Arrangement_2D::Face_handle) { Invalidate(); }
+	virtual void after_move_outer_ccb(Arrangement_2D::Ccb_halfedge_circulator) { Invalidate(); }
+	virtual void after_move_inner_ccb(Arrangement_2D::Ccb_halfedge_circulator) { Invalidate(); }
+	virtual void after_move_isolated_vertex(Arrangement_2D::Vertex_handle) { Invalidate(); }
+	virtual void after_remove_vertex() { Invalidate(); }
+	virtual void after_remove_edge() { Invalidate(); }
+
+private:
+	typedef std::pair<Query_Cache_Key, Location_Result_Type> Entry;
+
+	struct Shard
+	{
+		typedef std::unordered_map<Query_Cache_Key, typename std::list<Entry>::iterator, Query_Cache_Key_Hash> Index;
+
+		mutable std::mutex mutex;
+		std::list<Entry> lru;
+		Index index;
+	};
+
+	void Invalidate()
+	{
+		invalidations++;
+		Clear();
+	}
+
+	Strategy pl;
+	Query_Cache_Options options;
+	std::vector<Shard> shards;
+	size_t shardCapacity;
+	std::mutex locateMutex;
+	std::atomic<size_t> hits;
+	std::atomic<size_t> misses;
+	std::atomic<size_t> bypasses;
+	std::atomic<size_t> evictions;
+	std::atomic<size_t> invalidations;
+};
+#endif
@@ -0,0 +1,156 @@
+// Linker to Header File
+#include "SnapRounding.h"
+
+// * Sets are containers that store unique elements following a specific order.
+// * https://www.cplusplus.com/reference/set/set/
+#include <set>
+
+// * Lists are sequence containers that allow constant time insert and erase operations anywhere within the sequence.
+// * https://www.cplusplus.com/reference/list/list/
+#include <list>
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+namespace
+{
+	// The pixel centers are exact doubles only for powers of two.
+	bool IsValidPixelSize(double pixelSize)
+	{
+		int exponent;
+		return pixelSize > 0 && std::isfinite(pixelSize) && std::frexp(pixelSize, &exponent) == 0.5;
+	}
+
+	// A pixel center of the grid, as plain doubles: the snapped coordinates are exact doubles, and rebuilding the point
+	// from them drops the lazy exact number computed by the snap.
+	Point_2D GridPoint(const Point_2D& center)
+	{
+		return Point_2D(CGAL::to_double(center.x()), CGAL::to_double(center.y()));
+	}
+
+	bool IsPixelCenter(const Point_2D& point, double pixelSize)
+	{
+		// CGAL::to_interval
+		// Returns the interval approximation of a number; it is a single double if and only if the number is a double.
+		// https://doc.cgal.org/5.0.4/Algebraic_foundations/group__PkgAlgebraicFoundationsRef.html
+		std::pair<double, double> x = CGAL::to_interval(point.x());
+		std::pair<double, double> y = CGAL::to_interval(point.y());
+		return x.first == x.second && y.first == y.second
+			&& std::floor(x.first / pixelSize) + 0.5 == x.first / pixelSize
+			&& std::floor(y.first / pixelSize) + 0.5 == y.first / pixelSize;
+	}
+}
+
+Snap_Rounding_Options DefaultSnapRoundingOptions()
+{
+	Snap_Rounding_Options options;
+	options.pixelSize = 1.0;
+	options.iterated = true;
+	options.nrOfKdTrees = 1;
+	return options;
+}
+
+bool SnapRoundSegments(const Vector_Line_Segment_2D& segments, const Snap_Rounding_Options& options,
+	Vector_Line_Segment_2D& snapped, Snap_Rounding_Report* report)
+{
+	if (!IsValidPixelSize(options.pixelSize))
+	{
+		return false;
+	}
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	// CGAL::snap_rounding_2
+	// Writes one polyline (a list of pixel centers) per input segment; int_output = false keeps the centers in the input
+	// coordinates instead of pixel indices.
+	// https://doc.cgal.org/5.0.4/Snap_rounding_2/group__PkgSnapRounding2Ref.html
+	std::list<std::list<Point_2D>> polylines;
+	CGAL::snap_rounding_2<Snap_Rounding_Traits_2D>(segments.begin(), segments.end(), polylines, options.pixelSize,
+		options.iterated, false, options.nrOfKdTrees);
+
+	// Input segments that run along each other are rounded onto the same pixel centers: keep every output segment once,
+	// from its lexicographically smaller end point.
+	std::set<std::pair<std::pair<double, double>, std::pair<double, double>>> seen;
+	size_t collapsedSegments = 0;
+	size_t sharedSegments = 0;
+	snapped.clear();
+	for (std::list<std::list<Point_2D>>::const_iterator polyline = polylines.begin(); polyline != polylines.end(); polyline++)
+	{
+		if (polyline->size() < 2)
+		{
+			collapsedSegments++;
+			continue;
+		}
+		std::list<Point_2D>::const_iterator next = polyline->begin();
+		std::list<Point_2D>::const_iterator current = next++;
+		for (; next != polyline->end(); current = next++)
+		{
+			Point_2D source = GridPoint(*current);
+			Point_2D target = GridPoint(*next);
+			if (source == target)
+			{
+				continue;
+			}
+			if (target < source)
+			{
+				std::swap(source, target);
+			}
+			std::pair<double, double> a(CGAL::to_double(source.x()), CGAL::to_double(source.y()));
+			std::pair<double, double> b(CGAL::to_double(target.x()), CGAL::to_double(target.y()));
+			if (seen.insert(std::make_pair(a, b)).second)
+			{
+				snapped.push_back(Line_Segment_2D(source, target));
+			}
+			else
+			{
+				sharedSegments++;
+			}
+		}
+	}
+
+	if (report != nullptr)
+	{
+		report->inputSegments = segments.size();
+		report->outputSegments = snapped.size();
+		report->collapsedSegments = collapsedSegments;
+		report->sharedSegments = sharedSegments;
+		report->offGridVertices = 0;
+		report->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+	return true;
+}
+
+bool ConstructSnappedArrangment(const Vector_Line_Segment_2D& segments, const Snap_Rounding_Options& options,
+	Arrangement_2D& arr, Snap_Rounding_Report* report)
+{
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	Vector_Line_Segment_2D snapped;
+	if (!SnapRoundSegments(segments, options, snapped, report))
+	{
+		return false;
+	}
+
+	arr.clear();
+	insert(arr, snapped.begin(), snapped.end());
+	if (report != nullptr)
+	{
+		report->offGridVertices = 0;
+		for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+		{
+			if (!IsPixelCenter(v->point(), options.pixelSize))
+			{
+				report->offGridVertices++;
+			}
+		}
+		report->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+	return true;
+}
+
+void DisplaySnapRoundingReport(const Snap_Rounding_Report& report)
+{
+	std::cout << "Segments : " << report.inputSegments << " -> " << report.outputSegments
+		<< " (" << report.collapsedSegments << " collapsed to a pixel center, " << report.sharedSegments << " shared)" << std::endl;
+	std::cout << "Vertices off the grid : " << report.offGridVertices << std::endl;
+	std::cout << "Snap rounding time : " << std::fixed << std::setprecision(3) << report.seconds * 1e3 << " ms" << std::endl;
+}
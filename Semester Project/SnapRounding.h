@@ -0,0 +1,88 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// CGAL 2D Snap Rounding (iterated snap rounding)
+// https://doc.cgal.org/5.0.4/Snap_rounding_2/index.html
+
+#ifndef SNAP_ROUNDING_H
+#define SNAP_ROUNDING_H
+
+// Linker to Point Location Header File (Arrangement typedefs)
+#include "PointLocation.h"
+
+// --------------------------------------------------------------------
+
+// The function snap_rounding_2 rounds a set of segments onto a grid of pixels: every segment becomes a polyline through
+// the centers of the hot pixels (the pixels that contain an end point or an intersection point) it crosses, so that
+// the output only meets at pixel centers. With do_isr, a polyline is also kept at a distance from the pixel centers of
+// the other ones (iterated snap rounding).
+// https://doc.cgal.org/5.0.4/Snap_rounding_2/group__PkgSnapRounding2Ref.html
+#include <CGAL/Snap_rounding_traits_2.h>
+#include <CGAL/Snap_rounding_2.h>
+
+// --------------------------------------------------------------------
+
+// Snap_Rounding_Traits_2D :: CGAL::Snap_rounding_traits_2<Kernel>
+typedef CGAL::Snap_rounding_traits_2<Kernel> Snap_Rounding_Traits_2D;
+
+/*
+* The grid of a snap rounding pass: pixels of pixelSize x pixelSize whose centers, the output coordinates, are
+* (k + 0.5) * pixelSize. The size must be a power of two (1, 0.5, 0.25, ... or 2, 4, ...) so that the centers are exact
+* doubles. iterated selects iterated snap rounding, which keeps every output segment at least half a pixel away from the
+* vertices that are not on it; plain snap rounding is faster but may bring an edge arbitrarily close to a vertex.
+* nrOfKdTrees is the number of kd - trees used to find the hot pixels crossed by a segment.
+*/
+struct Snap_Rounding_Options
+{
+	double pixelSize;
+	bool iterated;
+	unsigned int nrOfKdTrees;
+};
+
+/*
+* This function is responsible for returning the default snap rounding options: unit pixels, iterated, one kd - tree.
+*/
+Snap_Rounding_Options DefaultSnapRoundingOptions();
+
+/*
+* The outcome of a snap rounding pass. collapsedSegments counts the input segments that became a single pixel center,
+* sharedSegments the output segments dropped because another input segment was rounded onto the same one, and
+* offGridVertices the vertices of the arrangement that are not pixel centers (always 0, filled by
+* ConstructSnappedArrangment only).
+*/
+struct Snap_Rounding_Report
+{
+	size_t inputSegments;
+	size_t outputSegments;
+	size_t collapsedSegments;
+	size_t sharedSegments;
+	size_t offGridVertices;
+	double seconds;
+};
+
+/*
+* This function is responsible for snap rounding the given segments onto the grid of the given options. The output
+* segments have double end points on the grid and meet only at shared end points (or overlap), so inserting them into
+* an arrangement creates no new vertex and no construction. Returns false if the pixel size is not a positive power
+* of two.
+*/
+bool SnapRoundSegments(const Vector_Line_Segment_2D& segments, const Snap_Rounding_Options& options,
+	Vector_Line_Segment_2D& snapped, Snap_Rounding_Report* report = nullptr);
+
+/*
+* This function is responsible for constructing the arrangment of the given segments snap rounded onto the grid of the
+* given options. Unlike ConstructArrangment, whose intersection vertices are exact rationals that SaveArrangment prints
+* as rounded decimals, every vertex is a pixel center: a double that WriteArrangmentSnapshot prints with enough digits
+* to be read back exactly, so saving it with WriteArrangmentSnapshot and loading it with LoadArrangment reproduce the
+* arrangment without slivers or extra vertices (CheckArrangmentRoundTrip checks it). Returns false if the pixel size is
+* not a positive power of two.
+* Example: Arrangement_2D arr; ConstructSnappedArrangment(segments, DefaultSnapRoundingOptions(), arr);
+*/
+bool ConstructSnappedArrangment(const Vector_Line_Segment_2D& segments, const Snap_Rounding_Options& options,
+	Arrangement_2D& arr, Snap_Rounding_Report* report = nullptr);
+
+/*
+* This function is responsible for displaying the given report to the screen.
+*/
+void DisplaySnapRoundingReport(const Snap_Rounding_Report& report);
+#endif
@@ -0,0 +1,711 @@
+// Linker to Header File
+#include "TiledPointLocation.h"
+
+// * Header that declares the std::rename and std::remove file operations.
+// * https://www.cplusplus.com/reference/cstdio/rename/
+#include <cstdio>
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// * Header that defines fixed width integer types (std::uint32_t, std::uint64_t).
+// * https://www.cplusplus.com/reference/cstdint/
+#include <cstdint>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that provides facilities for performing operations on file systems (std::filesystem::create_directories).
+// * https://en.cppreference.com/w/cpp/filesystem
+#include <filesystem>
+
+namespace
+{
+	const char Tile_Magic[4] = { 'G', 'T', 'I', 'L' };
+	const char Grid_Magic[4] = { 'G', 'I', 'D', 'X' };
+	const std::uint32_t Tile_Format_Version = 3;
+
+	template <class T>
+	void WriteValue(std::ofstream& file, const T& value)
+	{
+		file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <class T>
+	bool ReadValue(std::ifstream& file, T& value)
+	{
+		return (bool)file.read(reinterpret_cast<char*>(&value), sizeof(T));
+	}
+
+	bool ReadHeader(std::ifstream& file, const char magic[4])
+	{
+		char found[4];
+		std::uint32_t version;
+		return file.read(found, 4) && std::equal(found, found + 4, magic) && ReadValue(file, version) && version == Tile_Format_Version;
+	}
+
+	// Closes the temporary file and renames it over path (see WriteArrangmentSnapshot).
+	bool CommitFile(std::ofstream& file, const String& temporaryPath, const String& path)
+	{
+		file.close();
+		if (file.fail())
+		{
+			std::remove(temporaryPath.c_str());
+			return false;
+		}
+		return std::rename(temporaryPath.c_str(), path.c_str()) == 0;
+	}
+
+	// Left (lower) side of cell i of n cells over [lo, hi]; side n is hi.
+	double CellSide(double lo, double hi, int n, int i)
+	{
+		return i <= 0 ? lo : i >= n ? hi : lo + (hi - lo) * i / n;
+	}
+
+	// Cell of the coordinate v in n cells over [lo, hi], clamped to [0, n - 1]: the cell i with CellSide(i) <= v <
+	// CellSide(i + 1). The estimate is corrected against the sides, so that the cells and the tile rectangles agree.
+	int CellOf(double v, double lo, double hi, int n)
+	{
+		if (!(hi > lo))
+		{
+			return 0;
+		}
+		double t = std::floor((v - lo) / (hi - lo) * n);
+		int i = t < 0 ? 0 : t >= n - 1 ? n - 1 : (int)t;
+		while (i > 0 && v < CellSide(lo, hi, n, i))
+		{
+			i--;
+		}
+		while (i < n - 1 && v >= CellSide(lo, hi, n, i + 1))
+		{
+			i++;
+		}
+		return i;
+	}
+
+	// First cell whose closed interval holds v: the cell of v, or the one before when v is on their shared side.
+	int FirstCellOf(double v, double lo, double hi, int n)
+	{
+		int i = CellOf(v, lo, hi, n);
+		return i > 0 && v == CellSide(lo, hi, n, i) ? i - 1 : i;
+	}
+
+	bool InsideBox(const CGAL::Bbox_2& box, const Point_2D& point)
+	{
+		return CGAL::compare(point.x(), Kernel::FT(box.xmin())) != CGAL::SMALLER
+			&& CGAL::compare(point.x(), Kernel::FT(box.xmax())) != CGAL::LARGER
+			&& CGAL::compare(point.y(), Kernel::FT(box.ymin())) != CGAL::SMALLER
+			&& CGAL::compare(point.y(), Kernel::FT(box.ymax())) != CGAL::LARGER;
+	}
+
+	// Sides of a tile rectangle, as returned by EdgeSide.
+	enum Tile_Side
+	{
+		TILE_BOTTOM,
+		TILE_RIGHT,
+		TILE_TOP,
+		TILE_LEFT
+	};
+
+	// An edge inside the rectangle that is not on one of its sides.
+	const int Interior_Edge = -1;
+
+	// An edge outside the rectangle (a piece of a segment that leaves the tile).
+	const int Exterior_Edge = -2;
+
+	bool OnSideLine(const CGAL::Bbox_2& box, int side, const Point_2D& point)
+	{
+		switch (side)
+		{
+		case TILE_BOTTOM:
+			return CGAL::compare(point.y(), Kernel::FT(box.ymin())) == CGAL::EQUAL;
+		case TILE_RIGHT:
+			return CGAL::compare(point.x(), Kernel::FT(box.xmax())) == CGAL::EQUAL;
+		case TILE_TOP:
+			return CGAL::compare(point.y(), Kernel::FT(box.ymax())) == CGAL::EQUAL;
+		default:
+			return CGAL::compare(point.x(), Kernel::FT(box.xmin())) == CGAL::EQUAL;
+		}
+	}
+
+	// Side of the rectangle the edge lies on, Interior_Edge or Exterior_Edge. A segment between two points of the
+	// closed rectangle lies in it, so an edge is inside exactly when its end points are.
+	int EdgeSide(const CGAL::Bbox_2& box, HalfEdge_handle edge)
+	{
+		const Point_2D& source = edge->source()->point();
+		const Point_2D& target = edge->target()->point();
+		if (!InsideBox(box, source) || !InsideBox(box, target))
+		{
+			return Exterior_Edge;
+		}
+		for (int side = TILE_BOTTOM; side <= TILE_LEFT; side++)
+		{
+			if (OnSideLine(box, side, source) && OnSideLine(box, side, target))
+			{
+				return side;
+			}
+		}
+		return Interior_Edge;
+	}
+
+	// Coordinate of the point along a side of the rectangle.
+	Kernel::FT AlongSide(int side, const Point_2D& point)
+	{
+		return side == TILE_BOTTOM || side == TILE_TOP ? point.x() : point.y();
+	}
+
+	// Sorted, disjoint intervals along a side of the rectangle covered by segments of the tile.
+	typedef std::vector<std::pair<Kernel::FT, Kernel::FT>> Covered_Intervals;
+
+	void MergeIntervals(Covered_Intervals& intervals)
+	{
+		std::sort(intervals.begin(), intervals.end(), [](const std::pair<Kernel::FT, Kernel::FT>& a, const std::pair<Kernel::FT, Kernel::FT>& b)
+		{
+			return CGAL::compare(a.first, b.first) == CGAL::SMALLER;
+		});
+		size_t merged = 0;
+		for (size_t i = 0; i < intervals.size(); i++)
+		{
+			if (merged > 0 && CGAL::compare(intervals[i].first, intervals[merged - 1].second) != CGAL::LARGER)
+			{
+				if (CGAL::compare(intervals[i].second, intervals[merged - 1].second) == CGAL::LARGER)
+				{
+					intervals[merged - 1].second = intervals[i].second;
+				}
+			}
+			else
+			{
+				intervals[merged++] = intervals[i];
+			}
+		}
+		intervals.resize(merged);
+	}
+
+	bool Covered(const Covered_Intervals& intervals, const Kernel::FT& value)
+	{
+		Covered_Intervals::const_iterator after = std::upper_bound(intervals.begin(), intervals.end(), value, [](const Kernel::FT& v, const std::pair<Kernel::FT, Kernel::FT>& interval)
+		{
+			return CGAL::compare(v, interval.first) == CGAL::SMALLER;
+		});
+		return after != intervals.begin() && CGAL::compare(value, std::prev(after)->second) != CGAL::LARGER;
+	}
+
+	/*
+	* Labels the features of a tile's arrangement (BuildTile) with stitching nodes: every face inside the rectangle gets
+	* its own node, numbered from firstNode; an edge on a side of the rectangle that no segment covers, and a vertex
+	* that is only on such edges, get the node of the face inside along it; every other feature is -1. sides receives,
+	* for each side (Tile_Side) and in order along it, the node of every piece of the side, or -1 for the pieces covered
+	* by a segment. Returns the number of nodes used.
+	*/
+	int LabelTile(const Vector_Line_Segment_2D& segmentVector, const CGAL::Bbox_2& box, const Arrangement_2D& arr, int firstNode,
+		Tile_Face_Labels& labels, std::vector<int> sides[4])
+	{
+		Covered_Intervals covered[4];
+		for (int i = 0; i < segmentVector.size(); i++)
+		{
+			for (int side = TILE_BOTTOM; side <= TILE_LEFT; side++)
+			{
+				if (OnSideLine(box, side, segmentVector[i].source()) && OnSideLine(box, side, segmentVector[i].target()))
+				{
+					Kernel::FT a = AlongSide(side, segmentVector[i].source());
+					Kernel::FT b = AlongSide(side, segmentVector[i].target());
+					covered[side].push_back(CGAL::compare(a, b) == CGAL::LARGER ? std::make_pair(b, a) : std::make_pair(a, b));
+				}
+			}
+		}
+		for (int side = TILE_BOTTOM; side <= TILE_LEFT; side++)
+		{
+			MergeIntervals(covered[side]);
+		}
+
+		Arrangement_Index index(arr);
+		labels.vertices.assign(index.NumberOfVertices(), -1);
+		labels.edges.assign(index.NumberOfEdges(), -1);
+		labels.faces.assign(index.NumberOfFaces(), -1);
+
+		// The faces inside the rectangle are the ones along an edge inside it: both sides of an interior edge, and the
+		// inner side of an edge on a side (faces lie to the left of their half - edges: the inner side of the bottom and
+		// right sides runs from left to right, that of the top and left sides from right to left).
+		std::vector<char> inside(index.NumberOfFaces(), false);
+		std::vector<char> open(index.NumberOfEdges(), false);
+		std::vector<int> innerFace(index.NumberOfEdges(), -1);
+		std::vector<std::pair<Point_2D, int>> pieces[4];
+		for (size_t e = 0; e < index.NumberOfEdges(); e++)
+		{
+			HalfEdge_handle edge = index.Edge((int)e);
+			int side = EdgeSide(box, edge);
+			if (side == Interior_Edge)
+			{
+				inside[index.FaceIndex(edge->face())] = true;
+				inside[index.FaceIndex(edge->twin()->face())] = true;
+			}
+			else if (side != Exterior_Edge)
+			{
+				bool leftToRight = side == TILE_BOTTOM || side == TILE_RIGHT;
+				HalfEdge_handle inner = (edge->direction() == CGAL::ARR_LEFT_TO_RIGHT) == leftToRight ? edge : edge->twin();
+				innerFace[e] = index.FaceIndex(inner->face());
+				inside[innerFace[e]] = true;
+				open[e] = !Covered(covered[side], (AlongSide(side, edge->source()->point()) + AlongSide(side, edge->target()->point())) / 2);
+				pieces[side].push_back(std::make_pair(std::min(edge->source()->point(), edge->target()->point()), (int)e));
+			}
+		}
+
+		int nrOfNodes = 0;
+		for (size_t f = 0; f < index.NumberOfFaces(); f++)
+		{
+			if (inside[f])
+			{
+				labels.faces[f] = firstNode + nrOfNodes++;
+			}
+		}
+		for (size_t e = 0; e < index.NumberOfEdges(); e++)
+		{
+			if (open[e])
+			{
+				labels.edges[e] = labels.faces[innerFace[e]];
+			}
+		}
+		for (int side = TILE_BOTTOM; side <= TILE_LEFT; side++)
+		{
+			std::sort(pieces[side].begin(), pieces[side].end(), [](const std::pair<Point_2D, int>& a, const std::pair<Point_2D, int>& b)
+			{
+				return CGAL::compare_xy(a.first, b.first) == CGAL::SMALLER;
+			});
+			sides[side].clear();
+			for (size_t i = 0; i < pieces[side].size(); i++)
+			{
+				sides[side].push_back(labels.edges[pieces[side][i].second]);
+			}
+		}
+
+		// A vertex inside the rectangle that is on no segment is a corner with only uncovered sides around it.
+		for (size_t v = 0; v < index.NumberOfVertices(); v++)
+		{
+			Vertex_handle vertex = index.Vertex((int)v);
+			if (vertex->is_isolated() || !InsideBox(box, vertex->point()))
+			{
+				continue;
+			}
+			int label = -1;
+			bool onSegment = false;
+			Arrangement_2D::Halfedge_around_vertex_const_circulator first = vertex->incident_halfedges();
+			Arrangement_2D::Halfedge_around_vertex_const_circulator current = first;
+			do
+			{
+				int e = index.EdgeIndex(current);
+				onSegment = onSegment || !open[e];
+				label = labels.edges[e];
+			} while (++current != first);
+			labels.vertices[v] = onSegment ? -1 : label;
+		}
+		return nrOfNodes;
+	}
+
+	// Root of a stitching node, with path halving.
+	int FindNode(std::vector<int>& parent, int node)
+	{
+		while (parent[node] != node)
+		{
+			parent[node] = parent[parent[node]];
+			node = parent[node];
+		}
+		return node;
+	}
+
+	// Joins the pieces of a side shared by two tiles, or (other == nullptr) the pieces of a side on the border of the
+	// grid with the unbounded face (node 0). Returns false if the two tiles do not split the side into the same pieces.
+	bool StitchSide(std::vector<int>& parent, const std::vector<int>& pieces, const std::vector<int>* other)
+	{
+		if (other != nullptr && other->size() != pieces.size())
+		{
+			return false;
+		}
+		for (size_t i = 0; i < pieces.size(); i++)
+		{
+			int node = other != nullptr ? (*other)[i] : 0;
+			if (pieces[i] >= 0 && node >= 0)
+			{
+				parent[FindNode(parent, pieces[i])] = FindNode(parent, node);
+			}
+		}
+		return true;
+	}
+
+	/*
+	* Reads a tile file (see WriteTile); the segment count and the label counts must match the size of the file, so a
+	* corrupt header cannot trigger a huge allocation.
+	*/
+	bool ReadTileFile(String path, Vector_Line_Segment_2D& segmentVector, Tile_Face_Labels& labels)
+	{
+		std::ifstream myfile(path, std::ios::binary);
+		std::uint64_t nrOfSegments;
+		if (!myfile.is_open() || !ReadHeader(myfile, Tile_Magic) || !ReadValue(myfile, nrOfSegments))
+		{
+			return false;
+		}
+		std::streampos first = myfile.tellg();
+		myfile.seekg(0, std::ios::end);
+		std::streamoff available = myfile.tellg() - first;
+		myfile.seekg(first);
+		if (available < 0 || nrOfSegments > (std::uint64_t)available / (4 * sizeof(double)))
+		{
+			return false;
+		}
+		std::vector<double> coordinates(4 * nrOfSegments);
+		std::uint64_t counts[3];
+		if (!myfile.read(reinterpret_cast<char*>(coordinates.data()), coordinates.size() * sizeof(double))
+			|| !ReadValue(myfile, counts[0]) || !ReadValue(myfile, counts[1]) || !ReadValue(myfile, counts[2]))
+		{
+			return false;
+		}
+		std::uint64_t labelBytes = (std::uint64_t)available - coordinates.size() * sizeof(double) - sizeof(counts);
+		if (counts[0] > labelBytes || counts[1] > labelBytes || counts[2] > labelBytes
+			|| (counts[0] + counts[1] + counts[2]) * sizeof(std::int32_t) != labelBytes)
+		{
+			return false;
+		}
+		segmentVector.clear();
+		segmentVector.reserve(nrOfSegments);
+		for (size_t i = 0; i < coordinates.size(); i += 4)
+		{
+			segmentVector.push_back(Line_Segment_2D(Point_2D(coordinates[i], coordinates[i + 1]), Point_2D(coordinates[i + 2], coordinates[i + 3])));
+		}
+		std::vector<int>* lists[3] = { &labels.vertices, &labels.edges, &labels.faces };
+		for (int l = 0; l < 3; l++)
+		{
+			lists[l]->resize(counts[l]);
+			for (size_t i = 0; i < lists[l]->size(); i++)
+			{
+				std::int32_t label;
+				if (!ReadValue(myfile, label) || label < -1)
+				{
+					return false;
+				}
+				(*lists[l])[i] = label;
+			}
+		}
+		return true;
+	}
+}
+
+size_t TileOf(const Tile_Grid& grid, double x, double y)
+{
+	int ix = CellOf(x, grid.minX, grid.maxX, grid.tilesX);
+	int iy = CellOf(y, grid.minY, grid.maxY, grid.tilesY);
+	return (size_t)iy * grid.tilesX + ix;
+}
+
+CGAL::Bbox_2 TileBox(const Tile_Grid& grid, size_t tile)
+{
+	int ix = (int)(tile % grid.tilesX);
+	int iy = (int)(tile / grid.tilesX);
+	return CGAL::Bbox_2(CellSide(grid.minX, grid.maxX, grid.tilesX, ix), CellSide(grid.minY, grid.maxY, grid.tilesY, iy),
+		CellSide(grid.minX, grid.maxX, grid.tilesX, ix + 1), CellSide(grid.minY, grid.maxY, grid.tilesY, iy + 1));
+}
+
+bool InsideTileGrid(const Tile_Grid& grid, const Point_2D& point)
+{
+	return InsideBox(CGAL::Bbox_2(grid.minX, grid.minY, grid.maxX, grid.maxY), point);
+}
+
+Tile_Grid PartitionIntoTiles(const Vector_Line_Segment_2D& segmentVector, int tilesX, int tilesY, std::vector<Vector_Line_Segment_2D>& tiles)
+{
+	Tile_Grid grid;
+	grid.tilesX = std::max(1, tilesX);
+	grid.tilesY = std::max(1, tilesY);
+	grid.minX = grid.minY = grid.maxX = grid.maxY = 0;
+	grid.unboundedFace = 0;
+	grid.nrOfFaces = 1;
+
+	std::vector<CGAL::Bbox_2> boxes;
+	boxes.reserve(segmentVector.size());
+	for (int i = 0; i < segmentVector.size(); i++)
+	{
+		boxes.push_back(segmentVector[i].bbox());
+	}
+	if (!boxes.empty())
+	{
+		CGAL::Bbox_2 box = boxes[0];
+		for (size_t i = 1; i < boxes.size(); i++)
+		{
+			box = box + boxes[i];
+		}
+		grid.minX = box.xmin();
+		grid.minY = box.ymin();
+		grid.maxX = box.xmax();
+		grid.maxY = box.ymax();
+	}
+	// Tiles have a positive area, also when the segments are all on one vertical or horizontal line.
+	if (!(grid.maxX > grid.minX))
+	{
+		grid.maxX = grid.minX + 1;
+	}
+	if (!(grid.maxY > grid.minY))
+	{
+		grid.maxY = grid.minY + 1;
+	}
+
+	tiles.assign((size_t)grid.tilesX * grid.tilesY, Vector_Line_Segment_2D());
+	for (int i = 0; i < segmentVector.size(); i++)
+	{
+		int ix0 = FirstCellOf(boxes[i].xmin(), grid.minX, grid.maxX, grid.tilesX);
+		int ix1 = CellOf(boxes[i].xmax(), grid.minX, grid.maxX, grid.tilesX);
+		int iy0 = FirstCellOf(boxes[i].ymin(), grid.minY, grid.maxY, grid.tilesY);
+		int iy1 = CellOf(boxes[i].ymax(), grid.minY, grid.maxY, grid.tilesY);
+		for (int iy = iy0; iy <= iy1; iy++)
+		{
+			for (int ix = ix0; ix <= ix1; ix++)
+			{
+				tiles[(size_t)iy * grid.tilesX + ix].push_back(segmentVector[i]);
+			}
+		}
+	}
+
+	grid.segmentCounts.resize(tiles.size());
+	for (size_t t = 0; t < tiles.size(); t++)
+	{
+		grid.segmentCounts[t] = tiles[t].size();
+	}
+	return grid;
+}
+
+void BuildTile(const Vector_Line_Segment_2D& segmentVector, const CGAL::Bbox_2& box, Arrangement_2D& arr)
+{
+	// The sides of the rectangle, without the empty ones and without repeating a side of a flat rectangle.
+	Point_2D corners[4] = { Point_2D(box.xmin(), box.ymin()), Point_2D(box.xmax(), box.ymin()), Point_2D(box.xmax(), box.ymax()), Point_2D(box.xmin(), box.ymax()) };
+	Vector_Line_Segment_2D tileSegments = segmentVector;
+	for (int i = 0; i < 4; i++)
+	{
+		bool repeated = i >= 2 && (i == 2 ? box.ymin() == box.ymax() : box.xmin() == box.xmax());
+		if (corners[i] != corners[(i + 1) % 4] && !repeated)
+		{
+			tileSegments.push_back(Line_Segment_2D(corners[i], corners[(i + 1) % 4]));
+		}
+	}
+	arr.clear();
+	BuildArrangmentWithHull(tileSegments, Vector_Point_2D(), arr);
+}
+
+String TilePath(String directory, size_t tile)
+{
+	return directory + "/tile_" + std::to_string(tile) + ".bin";
+}
+
+bool WriteTile(const Vector_Line_Segment_2D& segmentVector, const Tile_Face_Labels& labels, String path)
+{
+	String temporaryPath = path + ".tmp";
+	std::ofstream myfile(temporaryPath, std::ios::binary);
+	if (!myfile.is_open())
+	{
+		return false;
+	}
+	myfile.write(Tile_Magic, 4);
+	WriteValue(myfile, Tile_Format_Version);
+	WriteValue(myfile, (std::uint64_t)segmentVector.size());
+	for (int i = 0; i < segmentVector.size(); i++)
+	{
+		WriteValue(myfile, CGAL::to_double(segmentVector[i].source().x()));
+		WriteValue(myfile, CGAL::to_double(segmentVector[i].source().y()));
+		WriteValue(myfile, CGAL::to_double(segmentVector[i].target().x()));
+		WriteValue(myfile, CGAL::to_double(segmentVector[i].target().y()));
+	}
+	const std::vector<int>* lists[3] = { &labels.vertices, &labels.edges, &labels.faces };
+	for (int l = 0; l < 3; l++)
+	{
+		WriteValue(myfile, (std::uint64_t)lists[l]->size());
+	}
+	for (int l = 0; l < 3; l++)
+	{
+		for (size_t i = 0; i < lists[l]->size(); i++)
+		{
+			WriteValue(myfile, (std::int32_t)(*lists[l])[i]);
+		}
+	}
+	return CommitFile(myfile, temporaryPath, path);
+}
+
+bool ReadTile(String path, const CGAL::Bbox_2& box, Arrangement_2D& arr, Tile_Face_Labels& labels)
+{
+	arr.clear();
+	Vector_Line_Segment_2D segmentVector;
+	if (!ReadTileFile(path, segmentVector, labels))
+	{
+		return false;
+	}
+	// The arrangement is built as WriteTiles built it, so its features come in the order of the labels.
+	BuildTile(segmentVector, box, arr);
+	if (labels.vertices.size() != arr.number_of_vertices() || labels.edges.size() != arr.number_of_edges() || labels.faces.size() != arr.number_of_faces())
+	{
+		arr.clear();
+		return false;
+	}
+	return true;
+}
+
+bool WriteTiles(const Vector_Line_Segment_2D& segmentVector, int tilesX, int tilesY, String directory)
+{
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+
+	// The tiles store double coordinates, so they are built from the rounded segments, as ReadTile will.
+	Vector_Line_Segment_2D rounded;
+	rounded.reserve(segmentVector.size());
+	for (int i = 0; i < segmentVector.size(); i++)
+	{
+		Line_Segment_2D segment(Point_2D(CGAL::to_double(segmentVector[i].source().x()), CGAL::to_double(segmentVector[i].source().y())),
+			Point_2D(CGAL::to_double(segmentVector[i].target().x()), CGAL::to_double(segmentVector[i].target().y())));
+		if (!segment.is_degenerate())
+		{
+			rounded.push_back(segment);
+		}
+	}
+	std::vector<Vector_Line_Segment_2D> tiles;
+	Tile_Grid grid = PartitionIntoTiles(rounded, tilesX, tilesY, tiles);
+
+	// No arrangement of all the segments is built: every tile is built on its own, and its faces inside the rectangle
+	// are joined with the faces of the neighbouring tiles along the pieces of their shared sides that no segment covers
+	// (a tile holds every segment that meets its closed rectangle, so both tiles split a shared side the same way).
+	// Node 0 is the unbounded face, which holds the uncovered pieces of the border of the grid. Only the right side of
+	// the previous tile and the top sides of the previous row are kept.
+	std::vector<int> parent(1, 0);
+	std::vector<std::vector<int>> topSides(grid.tilesX);
+	std::vector<int> rightSide;
+	for (size_t t = 0; t < tiles.size(); t++)
+	{
+		int ix = (int)(t % grid.tilesX);
+		int iy = (int)(t / grid.tilesX);
+		CGAL::Bbox_2 box = TileBox(grid, t);
+		Arrangement_2D arr;
+		BuildTile(tiles[t], box, arr);
+		Tile_Face_Labels labels;
+		std::vector<int> sides[4];
+		int nrOfNodes = LabelTile(tiles[t], box, arr, (int)parent.size(), labels, sides);
+		for (int i = 0; i < nrOfNodes; i++)
+		{
+			parent.push_back((int)parent.size());
+		}
+		if (!StitchSide(parent, sides[TILE_LEFT], ix > 0 ? &rightSide : nullptr)
+			|| !StitchSide(parent, sides[TILE_BOTTOM], iy > 0 ? &topSides[ix] : nullptr)
+			|| (ix == grid.tilesX - 1 && !StitchSide(parent, sides[TILE_RIGHT], nullptr))
+			|| (iy == grid.tilesY - 1 && !StitchSide(parent, sides[TILE_TOP], nullptr)))
+		{
+			return false;
+		}
+		rightSide.swap(sides[TILE_RIGHT]);
+		topSides[ix].swap(sides[TILE_TOP]);
+		if (!WriteTile(tiles[t], labels, TilePath(directory, t)))
+		{
+			return false;
+		}
+	}
+
+	// Every class of joined nodes is a face of the full arrangement: number them, the unbounded face first, and
+	// rewrite the labels of the tiles (the segments are copied as they are).
+	std::vector<int> faceOfRoot(parent.size(), -1);
+	grid.nrOfFaces = 0;
+	for (size_t node = 0; node < parent.size(); node++)
+	{
+		int root = FindNode(parent, (int)node);
+		if (faceOfRoot[root] < 0)
+		{
+			faceOfRoot[root] = grid.nrOfFaces++;
+		}
+	}
+	grid.unboundedFace = faceOfRoot[FindNode(parent, 0)];
+	for (size_t t = 0; t < tiles.size(); t++)
+	{
+		Vector_Line_Segment_2D tileSegments;
+		Tile_Face_Labels labels;
+		if (!ReadTileFile(TilePath(directory, t), tileSegments, labels))
+		{
+			return false;
+		}
+		std::vector<int>* lists[3] = { &labels.vertices, &labels.edges, &labels.faces };
+		for (int l = 0; l < 3; l++)
+		{
+			for (size_t i = 0; i < lists[l]->size(); i++)
+			{
+				int& label = (*lists[l])[i];
+				label = label < 0 ? -1 : faceOfRoot[FindNode(parent, label)];
+			}
+		}
+		if (!WriteTile(tileSegments, labels, TilePath(directory, t)))
+		{
+			return false;
+		}
+	}
+
+	// The grid is written last, so a directory with a grid always has all its tiles.
+	String path = directory + "/tiles.idx";
+	String temporaryPath = path + ".tmp";
+	std::ofstream myfile(temporaryPath, std::ios::binary);
+	if (!myfile.is_open())
+	{
+		return false;
+	}
+	myfile.write(Grid_Magic, 4);
+	WriteValue(myfile, Tile_Format_Version);
+	WriteValue(myfile, (std::int32_t)grid.tilesX);
+	WriteValue(myfile, (std::int32_t)grid.tilesY);
+	WriteValue(myfile, (std::int32_t)grid.unboundedFace);
+	WriteValue(myfile, (std::int32_t)grid.nrOfFaces);
+	WriteValue(myfile, grid.minX);
+	WriteValue(myfile, grid.minY);
+	WriteValue(myfile, grid.maxX);
+	WriteValue(myfile, grid.maxY);
+	for (size_t t = 0; t < grid.segmentCounts.size(); t++)
+	{
+		WriteValue(myfile, (std::uint64_t)grid.segmentCounts[t]);
+	}
+	return CommitFile(myfile, temporaryPath, path);
+}
+
+bool ReadTileGrid(String directory, Tile_Grid& grid)
+{
+	std::ifstream myfile(directory + "/tiles.idx", std::ios::binary);
+	std::int32_t tilesX;
+	std::int32_t tilesY;
+	std::int32_t unboundedFace;
+	std::int32_t nrOfFaces;
+	if (!myfile.is_open() || !ReadHeader(myfile, Grid_Magic) || !ReadValue(myfile, tilesX) || !ReadValue(myfile, tilesY) || !ReadValue(myfile, unboundedFace)
+		|| !ReadValue(myfile, nrOfFaces) || tilesX < 1 || tilesY < 1 || unboundedFace < 0 || unboundedFace >= nrOfFaces)
+	{
+		return false;
+	}
+	grid.tilesX = tilesX;
+	grid.tilesY = tilesY;
+	grid.unboundedFace = unboundedFace;
+	grid.nrOfFaces = nrOfFaces;
+	if (!ReadValue(myfile, grid.minX) || !ReadValue(myfile, grid.minY) || !ReadValue(myfile, grid.maxX) || !ReadValue(myfile, grid.maxY))
+	{
+		return false;
+	}
+	grid.segmentCounts.resize((size_t)tilesX * tilesY);
+	for (size_t t = 0; t < grid.segmentCounts.size(); t++)
+	{
+		std::uint64_t count;
+		if (!ReadValue(myfile, count))
+		{
+			return false;
+		}
+		grid.segmentCounts[t] = count;
+	}
+	return true;
+}
+
+void DisplayTileCacheStats(const Tile_Cache_Stats& stats)
+{
+	double hitRate = stats.queries == 0 ? 0 : (double)stats.hits / stats.queries;
+	std::cout << "Queries : " << stats.queries
+		<< ",  Hits : " << stats.hits
+		<< ",  Misses : " << stats.misses
+		<< std::fixed << std::setprecision(2) << " (hit rate " << 100 * hitRate << "%)" << std::endl;
+	std::cout << "Evictions : " << stats.evictions
+		<< ",  Load failures : " << stats.loadFailures
+		<< ",  Tile load time : " << std::setprecision(3) << stats.loadSeconds * 1e3 << " ms" << std::endl;
+	std::cout << "Resident tiles : " << stats.residentTiles
+		<< ",  Resident bytes : " << stats.residentBytes
+		<< ",  Peak resident bytes : " << stats.peakResidentBytes << std::endl;
+}
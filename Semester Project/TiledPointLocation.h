@@ -0,0 +1,311 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Out - of - core point location: the segments are partitioned into a uniform grid of tiles, the arrangement of every
+// tile is stored on disk, and it is read (and its point location attached) when a query first reaches the tile and kept
+// in an LRU cache.
+
+#ifndef TILED_POINT_LOCATION_H
+#define TILED_POINT_LOCATION_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// Heap measurement of the loaded tiles
+#include "MemoryFootprint.h"
+
+// Linker to Vertical Decomposition Header File (Arrangement_Index, MakeVerticalRayHit)
+#include "VerticalDecomposition.h"
+
+// * Lists are sequence containers that allow constant time insert and erase operations anywhere within the sequence.
+// * https://www.cplusplus.com/reference/list/list/
+#include <list>
+
+// * Unordered maps are associative containers that store elements formed by the combination of a key value and a mapped value.
+// * https://www.cplusplus.com/reference/unordered_map/unordered_map/
+#include <unordered_map>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// --------------------------------------------------------------------
+
+/*
+* A uniform grid of tilesX * tilesY tiles over the rectangle [minX, maxX] x [minY, maxY] (the bounding box of the
+* segments). Tile (ix, iy) has index iy * tilesX + ix; segmentCounts holds the number of segments of every tile.
+* unboundedFace is the index of the unbounded face of the full arrangement, and nrOfFaces the number of its faces
+* (see Tile_Face_Labels).
+*/
+struct Tile_Grid
+{
+	double minX;
+	double minY;
+	double maxX;
+	double maxY;
+	int tilesX;
+	int tilesY;
+	int unboundedFace;
+	int nrOfFaces;
+	std::vector<size_t> segmentCounts;
+};
+
+/*
+* This function is responsible for returning the index of the tile of the point (x, y). Points outside the grid go to
+* the nearest border tile; a point on the side shared by two tiles goes to the right (upper) one.
+*/
+size_t TileOf(const Tile_Grid& grid, double x, double y);
+
+/*
+* This function is responsible for returning the closed rectangle of the given tile. It holds every point TileOf sends to
+* the tile, apart from the points outside the grid.
+*/
+CGAL::Bbox_2 TileBox(const Tile_Grid& grid, size_t tile);
+
+/*
+* This function is responsible for partitioning the given segments into a tilesX * tilesY grid over their bounding box.
+* A segment goes to every tile whose closed rectangle (TileBox) its bounding box meets, so every segment that passes
+* through the rectangle of a tile belongs to that tile: inside the rectangle, the arrangement of the tile's segments is
+* the full arrangement.
+*/
+Tile_Grid PartitionIntoTiles(const Vector_Line_Segment_2D& segmentVector, int tilesX, int tilesY, std::vector<Vector_Line_Segment_2D>& tiles);
+
+/*
+* The faces of the full arrangement (of all the segments) around the features of a tile's arrangement, numbered from 0
+* to nrOfFaces - 1 by WriteTiles, which never builds the full arrangement: it joins the faces of neighbouring tiles
+* across the pieces of their shared sides that no segment covers. vertices, edges and faces follow the order of an
+* Arrangement_Index of the tile's arrangement, and hold the face of the full arrangement that contains each vertex, edge
+* and face of the tile, or -1 for the vertices and edges that lie on a vertex or an edge of the full arrangement (the
+* sides of the tile are edges of its arrangement, and only some of them are). Only the features inside the rectangle of
+* the tile, the only ones a query reaches, are labelled.
+*/
+struct Tile_Face_Labels
+{
+	std::vector<int> vertices;
+	std::vector<int> edges;
+	std::vector<int> faces;
+};
+
+/*
+* This function is responsible for building the arrangement of a tile: the given segments of the tile and the sides of
+* its rectangle (so that no face of the tile inside the rectangle leaves it). The same segments always give the same
+* arrangement, in the same order of features, so the labels of a tile apply to the arrangement ReadTile builds again.
+*/
+void BuildTile(const Vector_Line_Segment_2D& segmentVector, const CGAL::Bbox_2& box, Arrangement_2D& arr);
+
+/*
+* This function is responsible for returning the path of the file of the given tile in the given directory.
+*/
+String TilePath(String directory, size_t tile);
+
+/*
+* This function is responsible for writting the segments of a tile and its labels to a binary tile file: a header
+* ("GTIL" and the format version), the number of segments and their end points as four doubles (32 bytes per segment),
+* the number of vertex, edge and face labels and the labels as 32 bit integers. Neither the arrangement nor its search
+* structure is written: ReadTile builds them again from the segments. The file is written to "<path>.tmp" and renamed
+* over path. Returns true on success.
+*/
+bool WriteTile(const Vector_Line_Segment_2D& segmentVector, const Tile_Face_Labels& labels, String path);
+
+/*
+* This function is responsible for reading a tile file written by WriteTile and building the arrangement of the tile with
+* the given rectangle (BuildTile). Returns false (and leaves arr empty) if the file does not exist, is not a tile file,
+* or its labels do not match the arrangement.
+*/
+bool ReadTile(String path, const CGAL::Bbox_2& box, Arrangement_2D& arr, Tile_Face_Labels& labels);
+
+/*
+* This function is responsible for partitioning the given segments, rounded to doubles (as PartitionIntoTiles), labelling
+* the tiles one at a time (see Tile_Face_Labels) and writting them to the given directory, which is created if needed:
+* the grid to "tiles.idx" and every tile to TilePath(directory, i). Only one tile's arrangement is in memory at a time.
+* Returns true on success.
+*/
+bool WriteTiles(const Vector_Line_Segment_2D& segmentVector, int tilesX, int tilesY, String directory);
+
+/*
+* This function is responsible for reading the grid of a tile directory written by WriteTiles.
+*/
+bool ReadTileGrid(String directory, Tile_Grid& grid);
+
+/*
+* This function is responsible for checking whether the given point lies in the closed rectangle of the grid; the points
+* outside it lie in the unbounded face of the full arrangement.
+*/
+bool InsideTileGrid(const Tile_Grid& grid, const Point_2D& point);
+
+/*
+* Counters of a tiled point location. residentBytes is the measured heap size of the tiles in the cache (arrangement,
+* lazy exact numbers and search structure); loadSeconds is the time spent reading tiles and attaching their point location.
+*/
+struct Tile_Cache_Stats
+{
+	size_t queries;
+	size_t hits;
+	size_t misses;
+	size_t evictions;
+	size_t loadFailures;
+	size_t residentTiles;
+	size_t residentBytes;
+	size_t peakResidentBytes;
+	double loadSeconds;
+};
+
+/*
+* This function is responsible for displaying the given cache counters to the screen.
+*/
+void DisplayTileCacheStats(const Tile_Cache_Stats& stats);
+
+/*
+* This class is responsible for point location over a tile directory written by WriteTiles, with one of the CGAL point
+* location strategies per tile. A query is routed to its tile by its coordinates; a tile that is not in the cache is
+* read (ReadTile) and the strategy attached. Tiles are evicted in least recently used order once the resident bytes
+* exceed the memory cap (the most recent tile always stays). A location result keeps its tile alive, so it stays valid
+* after the tile is evicted.
+* Example: Tiled_Point_Location<Trapezoid_Point_Location> tiled("tiles", 512 << 20);
+*/
+template <class Strategy>
+class Tiled_Point_Location
+{
+public:
+	// The point location object is declared after (and so destroyed before) the arrangement it is attached to.
+	struct Tile
+	{
+		Arrangement_2D arr;
+		Tile_Face_Labels labels;
+		bool loaded;
+		Arrangement_Index index;
+		Strategy pl;
+		size_t bytes;
+
+		Tile(String path, const CGAL::Bbox_2& box)
+			: loaded(ReadTile(path, box, arr, labels)), index(arr), pl(arr), bytes(0)
+		{
+		}
+	};
+
+	/*
+	* result: the feature of the tile's arrangement that contains the point (the sides of the tile are features of it).
+	* face: the face of the full arrangement that contains the point (see Tile_Face_Labels), or -1 if the point lies on a
+	* vertex or an edge of the full arrangement, or if its tile could not be read.
+	*/
+	struct Location
+	{
+		size_t tile;
+		Location_Result_Type result;
+		int face;
+		std::shared_ptr<const Tile> owner;
+	};
+
+	Tiled_Point_Location(String directory, size_t memoryCapBytes) : directory(directory), memoryCapBytes(memoryCapBytes), stats()
+	{
+		valid = ReadTileGrid(directory, grid);
+	}
+
+	/*
+	* False if the tile grid could not be read; every query then fails to load its tile and is located in an empty tile.
+	*/
+	bool Valid() const
+	{
+		return valid;
+	}
+
+	const Tile_Grid& Grid() const
+	{
+		return grid;
+	}
+
+	Location Locate(const Point_2D& point)
+	{
+		stats.queries++;
+		Location location;
+		location.tile = valid ? TileOf(grid, CGAL::to_double(point.x()), CGAL::to_double(point.y())) : 0;
+		location.owner = Acquire(location.tile);
+		location.result = location.owner->pl.locate(point);
+		location.face = -1;
+		if (location.owner->loaded)
+		{
+			Vertical_Ray_Hit feature = MakeVerticalRayHit(location.owner->index, location.result);
+			location.face = !InsideTileGrid(grid, point) ? grid.unboundedFace
+				: feature.vertex >= 0 ? location.owner->labels.vertices[feature.vertex]
+				: feature.edge >= 0 ? location.owner->labels.edges[feature.edge]
+				: location.owner->labels.faces[feature.face];
+		}
+		return location;
+	}
+
+	const Tile_Cache_Stats& Stats() const
+	{
+		return stats;
+	}
+
+	/*
+	* Drops every tile from the cache (the counters are kept).
+	*/
+	void Clear()
+	{
+		cache.clear();
+		lru.clear();
+		stats.residentTiles = 0;
+		stats.residentBytes = 0;
+	}
+
+private:
+	typedef std::list<size_t> Lru_List;
+
+	struct Cache_Entry
+	{
+		std::shared_ptr<const Tile> tile;
+		typename Lru_List::iterator position;
+	};
+
+	std::shared_ptr<const Tile> Acquire(size_t index)
+	{
+		typename std::unordered_map<size_t, Cache_Entry>::iterator found = cache.find(index);
+		if (found != cache.end())
+		{
+			stats.hits++;
+			lru.splice(lru.begin(), lru, found->second.position);
+			return found->second.tile;
+		}
+
+		stats.misses++;
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		size_t before = CurrentHeapBytes();
+		std::shared_ptr<Tile> tile = std::make_shared<Tile>(valid ? TilePath(directory, index) : String(), valid ? TileBox(grid, index) : CGAL::Bbox_2());
+		size_t after = CurrentHeapBytes();
+		if (!tile->loaded)
+		{
+			stats.loadFailures++;
+		}
+		tile->bytes = after > before ? after - before : ArrangmentFootprint(tile->arr).dcelBytes;
+		stats.loadSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+		lru.push_front(index);
+		Cache_Entry entry;
+		entry.tile = tile;
+		entry.position = lru.begin();
+		cache[index] = entry;
+		stats.residentBytes += tile->bytes;
+		stats.peakResidentBytes = std::max(stats.peakResidentBytes, stats.residentBytes);
+
+		while (stats.residentBytes > memoryCapBytes && lru.size() > 1)
+		{
+			size_t evicted = lru.back();
+			lru.pop_back();
+			stats.residentBytes -= cache[evicted].tile->bytes;
+			cache.erase(evicted);
+			stats.evictions++;
+		}
+		stats.residentTiles = cache.size();
+		return tile;
+	}
+
+	String directory;
+	size_t memoryCapBytes;
+	bool valid;
+	Tile_Grid grid;
+	Lru_List lru;
+	std::unordered_map<size_t, Cache_Entry> cache;
+	Tile_Cache_Stats stats;
+};
+#endif
@@ -0,0 +1,222 @@
+// Linker to Header File
+#include "TrapezoidIndex.h"
+
+// * Header that defines std::srand, which seeds the std::rand generator used to shuffle the insertion order.
+// * https://www.cplusplus.com/reference/cstdlib/srand/
+#include <cstdlib>
+
+// * POSIX initstate and setstate, which swap the state array of the generator behind std::rand in glibc.
+// * https://man7.org/linux/man-pages/man3/initstate.3.html
+#if defined(__GLIBC__)
+#include <stdlib.h>
+#endif
+
+// * Header that defines the std::mutex and std::lock_guard synchronization primitives.
+// * https://www.cplusplus.com/reference/mutex/
+#include <mutex>
+
+// * Header declaring a set of functions to compute common mathematical operations and transformations.
+// * https://www.cplusplus.com/reference/cmath/
+#include <cmath>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+namespace
+{
+	typedef std::chrono::steady_clock Clock;
+
+	// Value at the given quantile of sorted values (nearest rank).
+	size_t Quantile(const std::vector<size_t>& sorted, double q)
+	{
+		size_t rank = (size_t)std::ceil(q * sorted.size());
+		return sorted[std::min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)];
+	}
+
+	// Guards the std::rand state and the std::rand draws of a build.
+	std::mutex Seed_Mutex;
+}
+
+void AttachTrapezoidPointLocation(Trapezoid_Point_Location& pl, const Arrangement_2D& arr, bool withGuarantees, unsigned int seed)
+{
+	std::lock_guard<std::mutex> lock(Seed_Mutex);
+	pl.with_guarantees(withGuarantees);
+#if defined(__GLIBC__)
+	// glibc's std::rand draws from the random() generator: the build runs on a state array of its own (128 bytes, the
+	// size std::srand seeds, so it draws the same sequence as after std::srand(seed)), then the state of the caller is
+	// put back untouched.
+	char state[128];
+	char* callerState = initstate(seed, state, sizeof(state));
+	try
+	{
+		pl.attach(arr);
+	}
+	catch (...)
+	{
+		setstate(callerState);
+		throw;
+	}
+	setstate(callerState);
+#else
+	// The std::rand state cannot be saved elsewhere: the sequence of the caller goes on from a seed drawn from it.
+	unsigned int callerSeed = (unsigned int)std::rand();
+	std::srand(seed);
+	try
+	{
+		pl.attach(arr);
+	}
+	catch (...)
+	{
+		std::srand(callerSeed);
+		throw;
+	}
+	std::srand(callerSeed);
+#endif
+}
+
+Trapezoid_Options DefaultTrapezoidOptions()
+{
+	Trapezoid_Options options;
+	options.seed = 1;
+	options.withGuarantees = true;
+	options.maxQueryPathLength = 0;
+	options.maxSearchStructureBytes = 0;
+	options.maxRebuilds = 8;
+	return options;
+}
+
+Trapezoid_Index::Trapezoid_Index(const Arrangement_2D& arr, const Trapezoid_Options& options) : arr(arr), options(options), kept(0)
+{
+	BuildWithinCaps(options.seed);
+}
+
+void Trapezoid_Index::BuildWithinCaps(unsigned int firstSeed)
+{
+	size_t first = builds.size();
+	kept = first;
+	for (int attempt = 0; attempt <= options.maxRebuilds; attempt++)
+	{
+		builds.push_back(Build(firstSeed + attempt));
+		if (builds.back().withinCaps)
+		{
+			kept = builds.size() - 1;
+			return;
+		}
+		if (builds[kept].longestQueryPath > builds.back().longestQueryPath)
+		{
+			kept = builds.size() - 1;
+		}
+	}
+	// No build fits the caps: the same seed gives back the shallowest one.
+	if (kept != builds.size() - 1)
+	{
+		Build(builds[kept].seed);
+	}
+}
+
+Trapezoid_Build Trapezoid_Index::Build(unsigned int seed)
+{
+	pl.reset();
+	size_t before = CurrentHeapBytes();
+	Clock::time_point begin = Clock::now();
+	pl.reset(new Trapezoid_Point_Location());
+	AttachTrapezoidPointLocation(*pl, arr, options.withGuarantees, seed);
+	Clock::time_point end = Clock::now();
+	size_t after = CurrentHeapBytes();
+
+	Trapezoid_Build build;
+	build.seed = seed;
+	build.longestQueryPath = pl->longest_query_path_length();
+	build.searchStructureBytes = after > before ? after - before : 0;
+	build.buildSeconds = std::chrono::duration<double>(end - begin).count();
+	build.withinCaps = (options.maxQueryPathLength == 0 || build.longestQueryPath <= options.maxQueryPathLength)
+		&& (options.maxSearchStructureBytes == 0 || build.searchStructureBytes <= options.maxSearchStructureBytes);
+	return build;
+}
+
+bool Trapezoid_Index::Recheck()
+{
+	size_t longestQueryPath = pl->longest_query_path_length();
+	builds[kept].longestQueryPath = longestQueryPath;
+	builds[kept].withinCaps = options.maxQueryPathLength == 0 || longestQueryPath <= options.maxQueryPathLength;
+	if (!builds[kept].withinCaps || options.maxSearchStructureBytes != 0)
+	{
+		BuildWithinCaps(builds.back().seed + 1);
+	}
+	return builds[kept].withinCaps;
+}
+
+Location_Result_Type Trapezoid_Index::Locate(const Point_2D& point) const
+{
+	return pl->locate(point);
+}
+
+const Trapezoid_Point_Location& Trapezoid_Index::PointLocation() const
+{
+	return *pl;
+}
+
+const Trapezoid_Build& Trapezoid_Index::Kept() const
+{
+	return builds[kept];
+}
+
+const std::vector<Trapezoid_Build>& Trapezoid_Index::Builds() const
+{
+	return builds;
+}
+
+Trapezoid_Depth_Distribution SampleTrapezoidDepths(const Arrangement_2D& arr, bool withGuarantees, unsigned int firstSeed, int nrOfSeeds)
+{
+	Trapezoid_Depth_Distribution distribution;
+	for (int i = 0; i < nrOfSeeds; i++)
+	{
+		Trapezoid_Point_Location pl;
+		AttachTrapezoidPointLocation(pl, arr, withGuarantees, firstSeed + i);
+		distribution.depths.push_back(pl.longest_query_path_length());
+	}
+
+	std::vector<size_t> sorted = distribution.depths;
+	std::sort(sorted.begin(), sorted.end());
+	if (sorted.empty())
+	{
+		sorted.push_back(0);
+	}
+	distribution.min = sorted.front();
+	distribution.p50 = Quantile(sorted, 0.50);
+	distribution.p90 = Quantile(sorted, 0.90);
+	distribution.p99 = Quantile(sorted, 0.99);
+	distribution.max = sorted.back();
+	distribution.mean = 0;
+	for (size_t i = 0; i < sorted.size(); i++)
+	{
+		distribution.mean += (double)sorted[i] / sorted.size();
+	}
+	return distribution;
+}
+
+void DisplayTrapezoidBuilds(const Trapezoid_Index& index)
+{
+	const std::vector<Trapezoid_Build>& builds = index.Builds();
+	for (size_t i = 0; i < builds.size(); i++)
+	{
+		std::cout << "Seed " << builds[i].seed
+			<< " : longest query path " << builds[i].longestQueryPath
+			<< ",  " << builds[i].searchStructureBytes << " bytes"
+			<< std::fixed << std::setprecision(3) << ",  " << builds[i].buildSeconds * 1e3 << " ms"
+			<< (builds[i].withinCaps ? "" : "  (over the caps)") << std::endl;
+	}
+	std::cout << "Kept seed : " << index.Kept().seed << std::endl;
+}
+
+void DisplayTrapezoidDepthDistribution(const Trapezoid_Depth_Distribution& distribution)
+{
+	std::cout << "Longest query path over " << distribution.depths.size() << " seeds :"
+		<< " min " << distribution.min
+		<< ",  p50 " << distribution.p50
+		<< ",  p90 " << distribution.p90
+		<< ",  p99 " << distribution.p99
+		<< ",  max " << distribution.max
+		<< std::fixed << std::setprecision(2) << ",  mean " << distribution.mean << std::endl;
+}
@@ -0,0 +1,139 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Reproducible, depth - bounded builds of the trapezoidal map (RIC) point location
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/classCGAL_1_1Arr__trapezoid__ric__point__location.html
+
+#ifndef TRAPEZOID_INDEX_H
+#define TRAPEZOID_INDEX_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// Heap measurement of search structures
+#include "MemoryFootprint.h"
+
+// --------------------------------------------------------------------
+
+/*
+* This function is responsible for attaching the given trapezoidal map point location to the given arrangment, building
+* its search structure from the given seed. CGAL shuffles the insertion order of the randomized incremental construction
+* with std::rand and takes no generator of its own, so the build draws from std::rand seeded with the given seed, under a
+* lock shared by every build made through this function. The std::rand state of the caller is saved and restored around
+* the build with glibc; elsewhere it cannot be saved, and the caller's sequence goes on from a seed drawn from it.
+* Only this initial build is reproducible: the rebuilds CGAL makes later on its own (withGuarantees, after the
+* arrangement changes) draw from the std::rand state of the program at that time.
+*/
+void AttachTrapezoidPointLocation(Trapezoid_Point_Location& pl, const Arrangement_2D& arr, bool withGuarantees, unsigned int seed);
+
+/*
+* Options of a Trapezoid_Index build.
+* seed: the seed of the first build (then seed + 1, seed + 2, ... on every rebuild), so a build is reproducible.
+* withGuarantees: lets CGAL rebuild the structure itself when its depth or size exceed its internal thresholds.
+* maxQueryPathLength, maxSearchStructureBytes: caps on the longest query path of the search DAG and on its heap size
+* (0 = no cap). A build over a cap is discarded and rebuilt with the next seed, at most maxRebuilds times.
+*/
+struct Trapezoid_Options
+{
+	unsigned int seed;
+	bool withGuarantees;
+	size_t maxQueryPathLength;
+	size_t maxSearchStructureBytes;
+	int maxRebuilds;
+};
+
+/*
+* This function is responsible for returning the default options: seed 1, CGAL guarantees on, no caps, 8 rebuilds.
+*/
+Trapezoid_Options DefaultTrapezoidOptions();
+
+/*
+* One build of the search structure: its seed, the length of its longest query path, its heap size, and its build time.
+*/
+struct Trapezoid_Build
+{
+	unsigned int seed;
+	size_t longestQueryPath;
+	size_t searchStructureBytes;
+	double buildSeconds;
+	bool withinCaps;
+};
+
+/*
+* This class is responsible for a trapezoidal map point location attached to an arrangement, built with the given options.
+* Every build (the kept one and the discarded ones) is recorded. When no build fits the caps, the one with the shortest
+* longest query path is kept.
+* The attached structure follows the changes of the arrangment (CGAL updates it as an observer), but the caps are only
+* checked by the builds: after changing the arrangment, call Recheck. Only the builds are reproducible from their seeds;
+* the updates, and the rebuilds CGAL makes on its own with withGuarantees, are not (see AttachTrapezoidPointLocation).
+*/
+class Trapezoid_Index
+{
+public:
+	Trapezoid_Index(const Arrangement_2D& arr, const Trapezoid_Options& options);
+
+	Location_Result_Type Locate(const Point_2D& point) const;
+
+	/*
+	* The attached CGAL point location object.
+	*/
+	const Trapezoid_Point_Location& PointLocation() const;
+
+	/*
+	* The build that is kept.
+	*/
+	const Trapezoid_Build& Kept() const;
+
+	/*
+	* Every build, in order; the last one is not necessarily the kept one.
+	*/
+	const std::vector<Trapezoid_Build>& Builds() const;
+
+	/*
+	* Measures the longest query path of the attached structure again and, when it is over the cap, rebuilds with the
+	* seeds following the last one, as the constructor does. The heap size can only be measured by a build: with a heap
+	* cap, the structure is always rebuilt. Returns whether the kept build fits the caps.
+	*/
+	bool Recheck();
+
+private:
+	const Arrangement_2D& arr;
+	Trapezoid_Options options;
+	std::unique_ptr<Trapezoid_Point_Location> pl;
+	std::vector<Trapezoid_Build> builds;
+	size_t kept;
+
+	void BuildWithinCaps(unsigned int firstSeed);
+	Trapezoid_Build Build(unsigned int seed);
+};
+
+/*
+* The distribution of the longest query path of the search DAG over several seeded builds.
+*/
+struct Trapezoid_Depth_Distribution
+{
+	std::vector<size_t> depths;
+	size_t min;
+	size_t p50;
+	size_t p90;
+	size_t p99;
+	size_t max;
+	double mean;
+};
+
+/*
+* This function is responsible for building the trapezoidal map of the given arrangment with the seeds
+* firstSeed, ..., firstSeed + nrOfSeeds - 1 and returning the distribution of the longest query path length.
+*/
+Trapezoid_Depth_Distribution SampleTrapezoidDepths(const Arrangement_2D& arr, bool withGuarantees, unsigned int firstSeed, int nrOfSeeds);
+
+/*
+* This function is responsible for displaying the builds of the given index to the screen.
+*/
+void DisplayTrapezoidBuilds(const Trapezoid_Index& index);
+
+/*
+* This function is responsible for displaying the given depth distribution to the screen.
+*/
+void DisplayTrapezoidDepthDistribution(const Trapezoid_Depth_Distribution& distribution);
+#endif
@@ -0,0 +1,399 @@
+// Linker to Header File
+#include "VerticalDecomposition.h"
+
+// * Maps are associative containers that store elements formed by a combination of a key value and a mapped value, following a specific order.
+// * https://www.cplusplus.com/reference/map/map/
+#include <map>
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+// * Header that describes the characteristics of arithmetic types (infinity).
+// * https://www.cplusplus.com/reference/limits/numeric_limits/
+#include <limits>
+
+namespace
+{
+	// A wall feature that continues to the neighbouring vertex on the same vertical line: the vertical ray from a vertex
+	// hits that vertex, or runs along a vertical edge to it.
+	const int Column_Neighbour = -2;
+
+	// A vertex of the decomposition: its wall features below and above (an edge, -1 for none, or Column_Neighbour) and its
+	// non vertical edges on either side, from bottom to top.
+	struct Decomposition_Vertex
+	{
+		bool newColumn;
+		double x;
+		int below;
+		int above;
+		std::vector<int> leftEdges;
+		std::vector<int> rightEdges;
+	};
+
+	int WallFeature(const CGAL::Object& feature, const Arrangement_Index& index)
+	{
+		HalfEdge_handle e;
+		Vertex_handle v;
+		if (CGAL::assign(e, feature))
+		{
+			return CGAL::compare_x(e->source()->point(), e->target()->point()) == CGAL::EQUAL ? Column_Neighbour : index.EdgeIndex(e);
+		}
+		if (CGAL::assign(v, feature))
+		{
+			return Column_Neighbour;
+		}
+		return -1;
+	}
+
+	// The edges of the given side of a vertex, from bottom to top: the edge a is below b if turning from a to b around the
+	// vertex is counter - clockwise on the right side, clockwise on the left side.
+	void SortFan(const Point_2D& center, std::vector<std::pair<int, Point_2D>>& fan, bool right, std::vector<int>& edges)
+	{
+		CGAL::Orientation lowerFirst = right ? CGAL::LEFT_TURN : CGAL::RIGHT_TURN;
+		std::sort(fan.begin(), fan.end(), [&center, lowerFirst](const std::pair<int, Point_2D>& a, const std::pair<int, Point_2D>& b)
+		{
+			return CGAL::orientation(center, a.second, b.second) == lowerFirst;
+		});
+		edges.clear();
+		for (size_t k = 0; k < fan.size(); k++)
+		{
+			edges.push_back(fan[k].first);
+		}
+	}
+
+	// The pairs of consecutive edges along one side of the vertical line of vertices[first .. last): each pair bounds a
+	// trapezoid ending (left side) or starting (right side) at this line. The edges of a side are the edge below the
+	// line, the fans of its vertices, the edges crossing the line between two of them, and the edge above the line.
+	void ColumnPairs(const std::vector<Decomposition_Vertex>& vertices, size_t first, size_t last, bool right, std::vector<std::pair<int, int>>& pairs)
+	{
+		pairs.clear();
+		std::vector<int> chain;
+		for (size_t i = first; i < last; i++)
+		{
+			const Decomposition_Vertex& v = vertices[i];
+			if (v.below != Column_Neighbour || chain.empty())
+			{
+				chain.assign(1, v.below == Column_Neighbour ? -1 : v.below);
+			}
+			const std::vector<int>& fan = right ? v.rightEdges : v.leftEdges;
+			chain.insert(chain.end(), fan.begin(), fan.end());
+			if (v.above != Column_Neighbour || i + 1 == last)
+			{
+				chain.push_back(v.above == Column_Neighbour ? -1 : v.above);
+				for (size_t k = 0; k + 1 < chain.size(); k++)
+				{
+					pairs.push_back(std::make_pair(chain[k], chain[k + 1]));
+				}
+				chain.clear();
+			}
+		}
+	}
+
+	// Sweeps the vertical lines from left to right: the trapezoids between the pairs of the left side of a line end there,
+	// those of the right side start there. Open trapezoids are keyed by their (bottom, top) edges, which are distinct
+	// since they are consecutive along the sweep line.
+	void Sweep(const std::vector<Decomposition_Vertex>& vertices, Vertical_Decomposition& decomposition)
+	{
+		const double infinity = std::numeric_limits<double>::infinity();
+		std::map<std::pair<int, int>, size_t> open;
+		open[std::make_pair(-1, -1)] = 0;
+		decomposition.leftX.push_back(-infinity);
+		decomposition.rightX.push_back(infinity);
+		decomposition.bottomEdge.push_back(-1);
+		decomposition.topEdge.push_back(-1);
+
+		std::vector<std::pair<int, int>> pairs;
+		for (size_t first = 0; first < vertices.size();)
+		{
+			size_t last = first + 1;
+			while (last < vertices.size() && !vertices[last].newColumn)
+			{
+				last++;
+			}
+			double x = vertices[first].x;
+
+			ColumnPairs(vertices, first, last, false, pairs);
+			for (size_t k = 0; k < pairs.size(); k++)
+			{
+				std::map<std::pair<int, int>, size_t>::iterator found = open.find(pairs[k]);
+				if (found != open.end())
+				{
+					decomposition.rightX[found->second] = x;
+					open.erase(found);
+				}
+			}
+			ColumnPairs(vertices, first, last, true, pairs);
+			for (size_t k = 0; k < pairs.size(); k++)
+			{
+				open[pairs[k]] = decomposition.leftX.size();
+				decomposition.leftX.push_back(x);
+				decomposition.rightX.push_back(infinity);
+				decomposition.bottomEdge.push_back(pairs[k].first);
+				decomposition.topEdge.push_back(pairs[k].second);
+			}
+			first = last;
+		}
+	}
+}
+
+Arrangement_Index::Arrangement_Index(const Arrangement_2D& arr)
+{
+	indices.reserve(arr.number_of_vertices() + 2 * arr.number_of_edges() + arr.number_of_faces());
+	for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+	{
+		indices[&(*v)] = (int)vertices.size();
+		vertices.push_back(v);
+	}
+	for (Arrangement_2D::Edge_const_iterator e = arr.edges_begin(); e != arr.edges_end(); e++)
+	{
+		indices[&(*e)] = (int)edges.size();
+		indices[&(*e->twin())] = (int)edges.size();
+		edges.push_back(e);
+	}
+	for (Arrangement_2D::Face_const_iterator f = arr.faces_begin(); f != arr.faces_end(); f++)
+	{
+		indices[&(*f)] = (int)faces.size();
+		faces.push_back(f);
+	}
+}
+
+int Arrangement_Index::VertexIndex(Vertex_handle v) const
+{
+	return indices.at(&(*v));
+}
+
+int Arrangement_Index::EdgeIndex(HalfEdge_handle e) const
+{
+	return indices.at(&(*e));
+}
+
+int Arrangement_Index::FaceIndex(Face_handle f) const
+{
+	return indices.at(&(*f));
+}
+
+Vertex_handle Arrangement_Index::Vertex(int i) const
+{
+	return vertices[i];
+}
+
+HalfEdge_handle Arrangement_Index::Edge(int i) const
+{
+	return edges[i];
+}
+
+Face_handle Arrangement_Index::Face(int i) const
+{
+	return faces[i];
+}
+
+size_t Arrangement_Index::NumberOfVertices() const
+{
+	return vertices.size();
+}
+
+size_t Arrangement_Index::NumberOfEdges() const
+{
+	return edges.size();
+}
+
+size_t Arrangement_Index::NumberOfFaces() const
+{
+	return faces.size();
+}
+
+Vertical_Ray_Hit MakeVerticalRayHit(const Arrangement_Index& index, const Location_Result_Type& result)
+{
+	Vertical_Ray_Hit hit = { -1, -1, -1 };
+	if (const Vertex_handle* v = boost::get<Vertex_handle>(&result))
+	{
+		hit.vertex = index.VertexIndex(*v);
+	}
+	else if (const HalfEdge_handle* e = boost::get<HalfEdge_handle>(&result))
+	{
+		hit.edge = index.EdgeIndex(*e);
+	}
+	else if (const Face_handle* f = boost::get<Face_handle>(&result))
+	{
+		hit.face = index.FaceIndex(*f);
+	}
+	return hit;
+}
+
+Vertical_Decomposition DecomposeArrangment(const Arrangement_2D& arr, const Arrangement_Index& index)
+{
+	Vertical_Decomposition decomposition;
+
+	// Every edge from its lexicographically smaller end point, and the faces above and below it.
+	std::vector<int> faceAbove(index.NumberOfEdges(), -1);
+	std::vector<int> faceBelow(index.NumberOfEdges(), -1);
+	decomposition.edges.reserve(4 * index.NumberOfEdges());
+	for (int e = 0; e < index.NumberOfEdges(); e++)
+	{
+		HalfEdge_handle h = index.Edge(e);
+		if (CGAL::compare_xy(h->source()->point(), h->target()->point()) == CGAL::LARGER)
+		{
+			h = h->twin();
+		}
+		// A halfedge has its face on its left: above it when it runs from left to right.
+		faceAbove[e] = index.FaceIndex(h->face());
+		faceBelow[e] = index.FaceIndex(h->twin()->face());
+		decomposition.edges.push_back(CGAL::to_double(h->source()->point().x()));
+		decomposition.edges.push_back(CGAL::to_double(h->source()->point().y()));
+		decomposition.edges.push_back(CGAL::to_double(h->target()->point().x()));
+		decomposition.edges.push_back(CGAL::to_double(h->target()->point().y()));
+	}
+
+	// CGAL::decompose
+	// Reports every vertex with the features hit by the vertical rays up and down from it (empty objects for none).
+	std::vector<std::pair<Vertex_handle, std::pair<CGAL::Object, CGAL::Object>>> walls;
+	walls.reserve(arr.number_of_vertices());
+	CGAL::decompose(arr, std::back_inserter(walls));
+	std::sort(walls.begin(), walls.end(), [](const std::pair<Vertex_handle, std::pair<CGAL::Object, CGAL::Object>>& a,
+		const std::pair<Vertex_handle, std::pair<CGAL::Object, CGAL::Object>>& b)
+	{
+		return CGAL::compare_xy(a.first->point(), b.first->point()) == CGAL::SMALLER;
+	});
+
+	std::vector<Decomposition_Vertex> vertices(walls.size());
+	std::vector<std::pair<int, Point_2D>> leftFan;
+	std::vector<std::pair<int, Point_2D>> rightFan;
+	for (size_t i = 0; i < walls.size(); i++)
+	{
+		Vertex_handle v = walls[i].first;
+		Decomposition_Vertex& vertex = vertices[i];
+		vertex.newColumn = i == 0 || CGAL::compare_x(walls[i - 1].first->point(), v->point()) != CGAL::EQUAL;
+		vertex.x = CGAL::to_double(v->point().x());
+		vertex.below = WallFeature(walls[i].second.first, index);
+		vertex.above = WallFeature(walls[i].second.second, index);
+
+		leftFan.clear();
+		rightFan.clear();
+		if (!v->is_isolated())
+		{
+			Arrangement_2D::Halfedge_around_vertex_const_circulator first = v->incident_halfedges();
+			Arrangement_2D::Halfedge_around_vertex_const_circulator current = first;
+			do
+			{
+				const Point_2D& other = current->source()->point();
+				CGAL::Comparison_result side = CGAL::compare_x(other, v->point());
+				if (side != CGAL::EQUAL)
+				{
+					(side == CGAL::LARGER ? rightFan : leftFan).push_back(std::make_pair(index.EdgeIndex(current), other));
+				}
+			} while (++current != first);
+		}
+		SortFan(v->point(), leftFan, false, vertex.leftEdges);
+		SortFan(v->point(), rightFan, true, vertex.rightEdges);
+	}
+	Sweep(vertices, decomposition);
+
+	int unboundedFace = index.FaceIndex(arr.unbounded_face());
+	decomposition.face.resize(decomposition.leftX.size());
+	for (size_t t = 0; t < decomposition.face.size(); t++)
+	{
+		int bottom = decomposition.bottomEdge[t];
+		int top = decomposition.topEdge[t];
+		decomposition.face[t] = bottom != -1 ? faceAbove[bottom] : (top != -1 ? faceBelow[top] : unboundedFace);
+	}
+	return decomposition;
+}
+
+bool TrapezoidContains(const Vertical_Decomposition& decomposition, size_t t, double x, double y)
+{
+	if (x < decomposition.leftX[t] || x > decomposition.rightX[t])
+	{
+		return false;
+	}
+	int bottom = decomposition.bottomEdge[t];
+	int top = decomposition.topEdge[t];
+	const double* edges = decomposition.edges.data();
+	if (bottom != -1)
+	{
+		const double* e = edges + 4 * bottom;
+		if ((e[2] - e[0]) * (y - e[1]) - (e[3] - e[1]) * (x - e[0]) < 0)
+		{
+			return false;
+		}
+	}
+	if (top != -1)
+	{
+		const double* e = edges + 4 * top;
+		if ((e[2] - e[0]) * (y - e[1]) - (e[3] - e[1]) * (x - e[0]) > 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CrossCheckVerticalDecomposition(const Arrangement_2D& arr, const Vector_Point_2D& points, int nrOfRandomPoints, unsigned int seed)
+{
+	Vector_Point_2D queries = points;
+	if (arr.number_of_vertices() > 0)
+	{
+		CGAL::Bbox_2 box = arr.vertices_begin()->point().bbox();
+		for (Arrangement_2D::Vertex_const_iterator v = arr.vertices_begin(); v != arr.vertices_end(); v++)
+		{
+			box = box + v->point().bbox();
+		}
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<double> x(box.xmin(), box.xmax());
+		std::uniform_real_distribution<double> y(box.ymin(), box.ymax());
+		for (int i = 0; i < nrOfRandomPoints; i++)
+		{
+			queries.push_back(Point_2D(x(generator), y(generator)));
+		}
+	}
+
+	Arrangement_Index index(arr);
+	Vertical_Decomposition decomposition = DecomposeArrangment(arr, index);
+	Naive_Point_Location naive_pl(arr);
+	for (size_t i = 0; i < queries.size(); i++)
+	{
+		Location_Result_Type result = naive_pl.locate(queries[i]);
+		const Face_handle* f = boost::get<Face_handle>(&result);
+		if (f == nullptr)
+		{
+			// On an edge or a vertex: on the boundary of the trapezoids around it.
+			continue;
+		}
+		double px = CGAL::to_double(queries[i].x());
+		double py = CGAL::to_double(queries[i].y());
+		int expected = index.FaceIndex(*f);
+		bool found = false;
+		for (size_t t = 0; t < decomposition.face.size() && !found; t++)
+		{
+			found = decomposition.face[t] == expected && TrapezoidContains(decomposition, t, px, py);
+		}
+		if (!found)
+		{
+			std::cout << "No trapezoid of face " << expected << " contains the point " << i << " (" << px << ", " << py << ")" << std::endl;
+			return false;
+		}
+	}
+
+	Trapezoid_Point_Location trapezoid_pl(arr);
+	Walk_Along_Line_Point_Location walk_along_line_pl(arr);
+	Ray_Direction directions[2] = { RAY_UP, RAY_DOWN };
+	for (int d = 0; d < 2; d++)
+	{
+		std::vector<Vertical_Ray_Hit> trapezoidHits = ShootVerticalRays(trapezoid_pl, index, queries, directions[d]);
+		std::vector<Vertical_Ray_Hit> walkHits = ShootVerticalRays(walk_along_line_pl, index, queries, directions[d]);
+		for (size_t i = 0; i < queries.size(); i++)
+		{
+			const Vertical_Ray_Hit& a = trapezoidHits[i];
+			const Vertical_Ray_Hit& b = walkHits[i];
+			if (a.vertex != b.vertex || a.edge != b.edge || a.face != b.face)
+			{
+				std::cout << "Vertical ray " << (directions[d] == RAY_UP ? "up" : "down") << " from the point " << i
+					<< " (" << CGAL::to_double(queries[i].x()) << ", " << CGAL::to_double(queries[i].y()) << ") hits"
+					<< " vertex " << a.vertex << ", edge " << a.edge << ", face " << a.face << " with Trapezoid_Point_Location but"
+					<< " vertex " << b.vertex << ", edge " << b.edge << ", face " << b.face << " with Walk_Along_Line_Point_Location" << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,140 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Vertical ray shooting and vertical decomposition of an arrangement
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/index.html#arr_ssecvert_decomp
+
+#ifndef VERTICAL_DECOMPOSITION_H
+#define VERTICAL_DECOMPOSITION_H
+
+// Linker to Point Location Header File (Arrangement and point location typedefs)
+#include "PointLocation.h"
+
+// * Unordered maps are associative containers that store elements formed by the combination of a key value and a mapped value.
+// * https://www.cplusplus.com/reference/unordered_map/unordered_map/
+#include <unordered_map>
+
+// --------------------------------------------------------------------
+
+// The function decompose(arr, oi) reports, for every vertex of an arrangement, the features hit by the vertical rays
+// shot up and down from it; the vertical walls through the vertices split the faces into pseudo - trapezoids.
+// https://doc.cgal.org/5.0.4/Arrangement_on_surface_2/group__PkgArrangementOnSurface2op__decompose.html
+#include <CGAL/Arr_vertical_decomposition_2.h>
+
+// --------------------------------------------------------------------
+
+/*
+* This class is responsible for numbering the vertices, edges and faces of the given arrangment in iterator order
+* (vertices_begin(), edges_begin() and faces_begin() to their end), so that results can be handed out as plain indices.
+* Both halfedges of an edge have the index of the edge. The arrangement must not change while the index is in use.
+*/
+class Arrangement_Index
+{
+public:
+	Arrangement_Index(const Arrangement_2D& arr);
+
+	int VertexIndex(Vertex_handle v) const;
+	int EdgeIndex(HalfEdge_handle e) const;
+	int FaceIndex(Face_handle f) const;
+
+	Vertex_handle Vertex(int i) const;
+	HalfEdge_handle Edge(int i) const;
+	Face_handle Face(int i) const;
+
+	size_t NumberOfVertices() const;
+	size_t NumberOfEdges() const;
+	size_t NumberOfFaces() const;
+
+private:
+	std::vector<Vertex_handle> vertices;
+	std::vector<HalfEdge_handle> edges;
+	std::vector<Face_handle> faces;
+	std::unordered_map<const void*, int> indices;
+};
+
+/*
+* The direction of a vertical ray.
+*/
+enum Ray_Direction
+{
+	RAY_UP,
+	RAY_DOWN
+};
+
+/*
+* The first feature hit by a vertical ray, as indices of an Arrangement_Index: the edge or the vertex hit (-1 if none),
+* or, when the ray hits nothing, the face it escapes through (the unbounded face for a bounded arrangement).
+*/
+struct Vertical_Ray_Hit
+{
+	int vertex;
+	int edge;
+	int face;
+};
+
+/*
+* This function is responsible for converting a ray shooting result (a vertex, a halfedge or a face handle) into a hit.
+*/
+Vertical_Ray_Hit MakeVerticalRayHit(const Arrangement_Index& index, const Location_Result_Type& result);
+
+/*
+* This function is responsible for shooting a vertical ray from every given point, up or down, with the given strategy
+* (Trapezoid_Point_Location, Walk_Along_Line_Point_Location, or the one of a Trapezoid_Index), and returning the first
+* feature hit by each ray, in the order of the points: "the first edge above / below p" for label placement and routing.
+* Example: Trapezoid_Point_Location pl(arr); Arrangement_Index index(arr);
+* std::vector<Vertical_Ray_Hit> above = ShootVerticalRays(pl, index, points, RAY_UP);
+*/
+template <class Strategy>
+std::vector<Vertical_Ray_Hit> ShootVerticalRays(const Strategy& pl, const Arrangement_Index& index, const Vector_Point_2D& points, Ray_Direction direction)
+{
+	std::vector<Vertical_Ray_Hit> hits;
+	hits.reserve(points.size());
+	for (int i = 0; i < points.size(); i++)
+	{
+		// ray_shoot_up / ray_shoot_down
+		// Return the first vertex or halfedge hit by the vertical ray from the point, or the face if there is none.
+		hits.push_back(MakeVerticalRayHit(index, direction == RAY_UP ? pl.ray_shoot_up(points[i]) : pl.ray_shoot_down(points[i])));
+	}
+	return hits;
+}
+
+/*
+* The vertical decomposition of an arrangement as flat arrays, free of CGAL handles: the vertical walls through the
+* vertices split every face into trapezoids (triangles when two edges meet at a wall, half - planes and slabs for the
+* unbounded face), each bounded by a bottom and a top edge (-1 for none) and by the walls at leftX and rightX (-inf and
+* +inf for the leftmost and rightmost ones). Edges, faces and trapezoids are numbered as in the Arrangement_Index
+* the decomposition was built with; the coordinates are double approximations.
+* Edge e runs from (edges[4e], edges[4e+1]) to (edges[4e+2], edges[4e+3]), its lexicographically smaller end point first.
+* Trapezoid t lies in face face[t], between the edges bottomEdge[t] and topEdge[t], for leftX[t] <= x <= rightX[t].
+*/
+struct Vertical_Decomposition
+{
+	std::vector<double> edges;
+	std::vector<double> leftX;
+	std::vector<double> rightX;
+	std::vector<int> bottomEdge;
+	std::vector<int> topEdge;
+	std::vector<int> face;
+};
+
+/*
+* This function is responsible for computing the vertical decomposition of the given arrangment (see above). Vertices
+* on a common vertical line share one wall. Runs in O(n log n) time for an arrangement of n features.
+*/
+Vertical_Decomposition DecomposeArrangment(const Arrangement_2D& arr, const Arrangement_Index& index);
+
+/*
+* This function is responsible for deciding, in doubles and in O(1), whether the given point lies in the trapezoid t of
+* the given decomposition (boundaries included).
+*/
+bool TrapezoidContains(const Vertical_Decomposition& decomposition, size_t t, double x, double y);
+
+/*
+* This function is responsible for cross checking the vertical decomposition and the vertical ray shooting of the given
+* arrangment on the given points and on nrOfRandomPoints points drawn with the given seed over the bounding box of its
+* vertices: every point that CGAL locates inside a face must lie in a trapezoid of DecomposeArrangment of that face, and
+* ShootVerticalRays must give the same hits, up and down, with Trapezoid_Point_Location and with
+* Walk_Along_Line_Point_Location. Returns false, and displays the first mismatch, if they ever differ.
+*/
+bool CrossCheckVerticalDecomposition(const Arrangement_2D& arr, const Vector_Point_2D& points, int nrOfRandomPoints, unsigned int seed);
+#endif
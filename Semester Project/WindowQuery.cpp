@@ -0,0 +1,153 @@
+// Linker to Header File
+#include "WindowQuery.h"
+
+// Chunked parallel loop over the windows
+#include "Parallel.h"
+
+// * Header that defines a collection of functions especially designed to be used on ranges of elements.
+// * https://www.cplusplus.com/reference/algorithm/
+#include <algorithm>
+
+namespace
+{
+	void SortUnique(std::vector<int>& indices)
+	{
+		std::sort(indices.begin(), indices.end());
+		indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+	}
+
+	bool WindowContains(const CGAL::Bbox_2& window, double x, double y)
+	{
+		return window.xmin() <= x && x <= window.xmax() && window.ymin() <= y && y <= window.ymax();
+	}
+}
+
+// The range constructor bulk loads the tree (packing), which gives better queries than one insertion per box.
+Window_Index::Window_Index(const Frozen_Arrangement& frozen) : frozen(frozen), tree(IndexEntries(frozen))
+{
+}
+
+Window_Query_Result Window_Index::Query(const CGAL::Bbox_2& window) const
+{
+	Window_Query_Result result;
+	std::vector<Index_Entry> candidates;
+	tree.query(boost::geometry::index::intersects(ToIndexBox(window)), std::back_inserter(candidates));
+	for (size_t k = 0; k < candidates.size(); k++)
+	{
+		int edge = candidates[k].second;
+		if (edge < 0)
+		{
+			// An isolated vertex: its box is the point itself.
+			result.vertices.push_back(-edge - 1);
+			continue;
+		}
+		if (!EdgeCrosses(edge, window))
+		{
+			continue;
+		}
+		result.edges.push_back(edge);
+		result.faces.push_back(frozen.halfEdgeFace[2 * edge]);
+		result.faces.push_back(frozen.halfEdgeFace[2 * edge + 1]);
+		for (int h = 2 * edge; h <= 2 * edge + 1; h++)
+		{
+			int v = frozen.halfEdgeTarget[h];
+			if (WindowContains(window, frozen.vertices[2 * v], frozen.vertices[2 * v + 1]))
+			{
+				result.vertices.push_back(v);
+			}
+		}
+	}
+
+	if (result.edges.empty())
+	{
+		// The window crosses no edge, so it lies inside a single face: the one of any of its corners that is not an
+		// isolated vertex.
+		double corners[4][2] = { { window.xmin(), window.ymin() }, { window.xmax(), window.ymin() }, { window.xmin(), window.ymax() }, { window.xmax(), window.ymax() } };
+		for (int c = 0; c < 4; c++)
+		{
+			Frozen_Location location = LocateFrozen(frozen, corners[c][0], corners[c][1]);
+			if (location.feature == FROZEN_FACE)
+			{
+				result.faces.push_back(location.index);
+				break;
+			}
+		}
+	}
+	SortUnique(result.vertices);
+	SortUnique(result.edges);
+	SortUnique(result.faces);
+	return result;
+}
+
+size_t Window_Index::CountCandidates(const CGAL::Bbox_2& window) const
+{
+	return (size_t)std::distance(tree.qbegin(boost::geometry::index::intersects(ToIndexBox(window))), tree.qend());
+}
+
+Window_Index::Index_Box Window_Index::ToIndexBox(const CGAL::Bbox_2& box)
+{
+	return Index_Box(Index_Point(box.xmin(), box.ymin()), Index_Point(box.xmax(), box.ymax()));
+}
+
+std::vector<Window_Index::Index_Entry> Window_Index::IndexEntries(const Frozen_Arrangement& frozen)
+{
+	std::vector<Index_Entry> entries;
+	entries.reserve(frozen.halfEdgeTarget.size() / 2);
+	for (int e = 0; 2 * e < frozen.halfEdgeTarget.size(); e++)
+	{
+		const double* source = &frozen.vertices[2 * frozen.halfEdgeTarget[2 * e + 1]];
+		const double* target = &frozen.vertices[2 * frozen.halfEdgeTarget[2 * e]];
+		CGAL::Bbox_2 box(std::min(source[0], target[0]), std::min(source[1], target[1]), std::max(source[0], target[0]), std::max(source[1], target[1]));
+		entries.push_back(Index_Entry(ToIndexBox(box), e));
+	}
+	for (int v = 0; v < frozen.vertexHalfEdge.size(); v++)
+	{
+		if (frozen.vertexHalfEdge[v] == -1)
+		{
+			CGAL::Bbox_2 box(frozen.vertices[2 * v], frozen.vertices[2 * v + 1], frozen.vertices[2 * v], frozen.vertices[2 * v + 1]);
+			entries.push_back(Index_Entry(ToIndexBox(box), -v - 1));
+		}
+	}
+	return entries;
+}
+
+bool Window_Index::EdgeCrosses(int edge, const CGAL::Bbox_2& window) const
+{
+	// The boxes overlap, so the segment crosses the window unless the four corners lie strictly on the same side of
+	// its supporting line (separating axis test).
+	const double* source = &frozen.vertices[2 * frozen.halfEdgeTarget[2 * edge + 1]];
+	const double* target = &frozen.vertices[2 * frozen.halfEdgeTarget[2 * edge]];
+	int above = 0;
+	int below = 0;
+	double xs[2] = { window.xmin(), window.xmax() };
+	double ys[2] = { window.ymin(), window.ymax() };
+	for (int i = 0; i < 2; i++)
+	{
+		for (int j = 0; j < 2; j++)
+		{
+			double side = (target[0] - source[0]) * (ys[j] - source[1]) - (target[1] - source[1]) * (xs[i] - source[0]);
+			above += side > 0;
+			below += side < 0;
+		}
+	}
+	return above < 4 && below < 4;
+}
+
+std::vector<Window_Query_Result> QueryWindows(const Window_Index& index, const std::vector<CGAL::Bbox_2>& windows, unsigned int nrOfThreads)
+{
+	std::vector<Window_Query_Result> results(windows.size());
+	ParallelFor(windows.size(), [&](size_t begin, size_t end, unsigned int)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			results[i] = index.Query(windows[i]);
+		}
+	}, nrOfThreads, 64);
+	return results;
+}
+
+void DisplayWindowQueryResult(const CGAL::Bbox_2& window, const Window_Query_Result& result)
+{
+	std::cout << "Window [" << window.xmin() << ", " << window.xmax() << "] x [" << window.ymin() << ", " << window.ymax() << "] : "
+		<< result.vertices.size() << " vertices, " << result.edges.size() << " edges, " << result.faces.size() << " faces" << std::endl;
+}
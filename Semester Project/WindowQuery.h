@@ -0,0 +1,82 @@
+//Header guards
+//https://www.educative.io/edpresso/what-are--sharpifndef-and--sharpdefine-used-for-in-cpp
+
+// Window queries: the vertices, edges and faces of an arrangement that intersect an axis - parallel rectangle.
+
+#ifndef WINDOW_QUERY_H
+#define WINDOW_QUERY_H
+
+// Linker to Frozen Arrangement Header File (flat, thread safe copy of the arrangement)
+#include "FrozenArrangement.h"
+
+// Bounding boxes of the windows
+// https://doc.cgal.org/5.0.4/Kernel_23/classCGAL_1_1Bbox__2.html
+#include <CGAL/Bbox_2.h>
+
+// Boost Geometry R - tree (Boost is already required by CGAL), the spatial index over the edge bounding boxes.
+// https://www.boost.org/doc/libs/1_74_0/libs/geometry/doc/html/geometry/spatial_indexes.html
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+// --------------------------------------------------------------------
+
+/*
+* The features that intersect a window, as indices of the frozen arrangement (and of its Arrangement_Index), each in
+* increasing order and without duplicates. Edges are given by edge index e (half-edges 2e and 2e+1).
+*/
+struct Window_Query_Result
+{
+	std::vector<int> vertices;
+	std::vector<int> edges;
+	std::vector<int> faces;
+};
+
+/*
+* This class is responsible for a spatial index over the edges and isolated vertices of a frozen arrangement: an R - tree
+* of their bounding boxes, bulk loaded once. A window query finds the candidates whose box overlaps the window, keeps the
+* edges that really cross it (a double test on the frozen coordinates) and collects their end points and faces; a
+* window that crosses no edge lies inside a single face, found by locating one of its corners. The query time is
+* O(log n + k) for k reported features in practice. The window is closed (its boundary is part of it); a degenerate
+* window whose corners are all isolated vertices reports no face (the frozen arrangement keeps no face for them).
+* The index only reads the frozen arrangement, which must outlive it; any number of threads may query it at once.
+* Example: Frozen_Arrangement frozen = FreezeArrangment(arr); Window_Index index(frozen);
+* Window_Query_Result tile = index.Query(CGAL::Bbox_2(0, 0, 256, 256));
+*/
+class Window_Index
+{
+public:
+	Window_Index(const Frozen_Arrangement& frozen);
+
+	Window_Query_Result Query(const CGAL::Bbox_2& window) const;
+
+	/*
+	* The edges whose bounding box overlaps the window (a superset of the edges that cross it), for a quick count.
+	*/
+	size_t CountCandidates(const CGAL::Bbox_2& window) const;
+
+private:
+	typedef boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian> Index_Point;
+	typedef boost::geometry::model::box<Index_Point> Index_Box;
+
+	// An edge e as e, an isolated vertex v as -(v + 1).
+	typedef std::pair<Index_Box, int> Index_Entry;
+
+	static Index_Box ToIndexBox(const CGAL::Bbox_2& box);
+	static std::vector<Index_Entry> IndexEntries(const Frozen_Arrangement& frozen);
+	bool EdgeCrosses(int edge, const CGAL::Bbox_2& window) const;
+
+	const Frozen_Arrangement& frozen;
+	boost::geometry::index::rtree<Index_Entry, boost::geometry::index::rstar<16>> tree;
+};
+
+/*
+* This function is responsible for answering the given window queries on the given number of threads (0 for all
+* hardware threads), in the order of the windows.
+*/
+std::vector<Window_Query_Result> QueryWindows(const Window_Index& index, const std::vector<CGAL::Bbox_2>& windows, unsigned int nrOfThreads = 0);
+
+/*
+* This function is responsible for displaying the number of vertices, edges and faces of the given result to the screen.
+*/
+void DisplayWindowQueryResult(const CGAL::Bbox_2& window, const Window_Query_Result& result);
+#endif